@@ -26,6 +26,7 @@ DingEditor::DingEditor(DingProcessor& p)
     : AudioProcessorEditor(&p),
       m_audioProcessor(p),
       m_volume_label("VolumeLabel", "Volume"),
+      m_decay_label("DecayLabel", "Decay"),
       m_keyboardComponent(p.m_keyboardState,
                           juce::KeyboardComponentBase::horizontalKeyboard)
 {
@@ -33,6 +34,7 @@ DingEditor::DingEditor(DingProcessor& p)
 
     setupKeyboard();
     setupGainKnob();
+    setupDecayKnob();
     startTimer(400);
 }
 
@@ -73,6 +75,31 @@ void DingEditor::setupGainKnob()
     m_volume_label.setJustificationType(juce::Justification::centred);
 }
 
+void DingEditor::setupDecayKnob()
+{
+    m_decay_attachment =
+        std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            m_audioProcessor.m_params, DingProcessor::s_decay_id,
+            m_decay_knob);
+
+    addAndMakeVisible(m_decay_knob);
+    m_decay_knob.setSliderStyle(
+        juce::Slider::SliderStyle::RotaryHorizontalVerticalDrag);
+    constexpr int value_textbox_width = 100;
+    constexpr int value_textbox_height = 25;
+    m_decay_knob.setTextBoxStyle(
+        juce::Slider::TextEntryBoxPosition::TextBoxBelow, true,
+        value_textbox_width, value_textbox_height);
+
+    m_decay_knob.setDoubleClickReturnValue(true, 3000.0);
+
+    addAndMakeVisible(m_decay_label);
+    m_decay_label.setText("Decay", juce::dontSendNotification);
+    m_decay_label.setColour(juce::Label::textColourId,
+                            juce::Colours::lightgreen);
+    m_decay_label.setJustificationType(juce::Justification::centred);
+}
+
 void DingEditor::resized()
 {
     juce::Rectangle<int> area = getLocalBounds();
@@ -82,8 +109,13 @@ void DingEditor::resized()
 
     m_keyboardComponent.setBounds(keyboardPanel);
 
+    auto decayPanel = sidePanel.removeFromRight(sidePanel.getWidth() / 2);
+
     m_volume_label.setBounds(sidePanel.removeFromTop(24));
     m_volume_knob.setBounds(sidePanel);
+
+    m_decay_label.setBounds(decayPanel.removeFromTop(24));
+    m_decay_knob.setBounds(decayPanel);
 }
 
 juce::String VolumeKnob::getTextFromValue(const double value)
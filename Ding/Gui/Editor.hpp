@@ -27,6 +27,7 @@ class DingEditor final : public juce::AudioProcessorEditor, public juce::Timer {
 
    private:
     void setupGainKnob();
+    void setupDecayKnob();
     void setupKeyboard();
 
    private:
@@ -37,6 +38,11 @@ class DingEditor final : public juce::AudioProcessorEditor, public juce::Timer {
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>
         m_volume_attachment;
 
+    juce::Slider m_decay_knob;
+    juce::Label m_decay_label;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>
+        m_decay_attachment;
+
     juce::MidiKeyboardComponent m_keyboardComponent;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DingEditor)
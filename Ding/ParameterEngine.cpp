@@ -0,0 +1,126 @@
+#include "ParameterEngine.hpp"
+
+#include "Processor.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/Glide.hpp"
+
+namespace {
+namespace impl {
+std::atomic<float>* handle(juce::AudioProcessorValueTreeState& params,
+                           const std::string& id)
+{
+    std::atomic<float>* parameter = params.getRawParameterValue(id);
+    jassert(parameter != nullptr);
+    return parameter;
+}
+
+float load(const std::atomic<float>* parameter)
+{
+    return parameter->load(std::memory_order_relaxed);
+}
+// a decay change should sound like a gesture, not a click
+static constexpr float decaySmoothingTime = 0.05f;  // 50 ms
+}  // namespace impl
+}  // namespace
+
+ParameterEngine::ParameterEngine(juce::AudioProcessorValueTreeState& params)
+    : m_volume(impl::handle(params, DingProcessor::s_volume_id)),
+      m_engine(impl::handle(params, DingProcessor::s_engine_id)),
+      m_model(impl::handle(params, DingProcessor::s_model_id)),
+      m_decayMs(impl::handle(params, DingProcessor::s_decay_id)),
+      m_glideCents(impl::handle(params, DingProcessor::s_glide_id)),
+      m_width(impl::handle(params, DingProcessor::s_width_id)),
+      m_decorrelate(impl::handle(params, DingProcessor::s_decorrelate_id))
+{
+}
+
+void ParameterEngine::prepare(const double sampleRate)
+{
+    m_sampleRate = sampleRate;
+    m_derivedDecayMs = -1.0f;
+    m_derivedGlideCents = -1.0f;
+    // derived at the old rate, the parameters have its values anyway
+    m_presets.clear();
+
+    // control rate only, no ramp to allocate
+    m_decaySmoother.prepare(sampleRate, 1, impl::decaySmoothingTime);
+    m_decaySmoother.reset(impl::load(m_decayMs));
+}
+
+const ParameterEngine::Snapshot& ParameterEngine::snapshot(
+    const int numSamples)
+{
+    const std::uint32_t ended = m_presetWritesEnded.load();
+    const std::uint32_t begun = m_presetWritesBegun.load();
+
+    // a whole preset, nothing left to derive or to smooth
+    if (m_presets.adopt(m_snapshot)) {
+        m_decaySmoother.reset(m_snapshot.decayMs);
+        m_derivedDecayMs = m_snapshot.decayMs;
+        m_derivedGlideCents = m_snapshot.glideCents;
+    }
+
+    // half a preset is written, the parameters would mix it with the last one
+    if (begun != ended) {
+        return m_snapshot;
+    }
+
+    Snapshot next = m_snapshot;
+    read(next);
+    // and one started while they were read
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_presetWritesBegun.load(std::memory_order_relaxed) != begun) {
+        return m_snapshot;
+    }
+
+    m_decaySmoother.setTarget(next.decayMs);
+    next.decayMs = m_decaySmoother.skip(numSamples);
+
+    if (next.decayMs != m_derivedDecayMs) {
+        next.masterDecay = Decay::coefficient(next.decayMs, m_sampleRate);
+        m_derivedDecayMs = next.decayMs;
+    }
+
+    if (next.glideCents != m_derivedGlideCents) {
+        next.glideDepth = Glide::depth(next.glideCents);
+        m_derivedGlideCents = next.glideCents;
+    }
+
+    m_snapshot = next;
+    return m_snapshot;
+}
+
+void ParameterEngine::read(Snapshot& snapshot) const
+{
+    snapshot.volume = impl::load(m_volume);
+    snapshot.engine =
+        static_cast<RenderEngine>(juce::roundToInt(impl::load(m_engine)));
+    snapshot.model =
+        static_cast<ModelId>(juce::roundToInt(impl::load(m_model)));
+    snapshot.decayMs = impl::load(m_decayMs);
+    snapshot.glideCents = impl::load(m_glideCents);
+    // the pan only moves with the width, a step is no click worth smoothing
+    snapshot.width = 0.01f * impl::load(m_width);
+    snapshot.decorrelate = impl::load(m_decorrelate) >= 0.5f;
+}
+
+ParameterEngine::Snapshot ParameterEngine::current() const
+{
+    Snapshot snapshot{};
+    read(snapshot);
+    snapshot.masterDecay = Decay::coefficient(snapshot.decayMs, m_sampleRate);
+    snapshot.glideDepth = Glide::depth(snapshot.glideCents);
+    return snapshot;
+}
+
+ParameterEngine::PresetWrite::PresetWrite(ParameterEngine& engine)
+    : m_engine(engine)
+{
+    m_engine.m_presetWritesBegun.fetch_add(1);
+}
+
+ParameterEngine::PresetWrite::~PresetWrite()
+{
+    m_engine.m_presets.publish(m_engine.current());
+    m_engine.m_presetWritesEnded.fetch_add(1);
+}
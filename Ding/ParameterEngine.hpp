@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "Synth/ModalModel.hpp"
+#include "Synth/RenderEngine.hpp"
+#include "core/SnapshotExchange.hpp"
+#include "core/Smoother.hpp"
+
+// the audio thread's view of the plugin parameters
+//
+// the parameter handles are resolved once, processBlock takes one snapshot at
+// the top of the block and nothing reads the APVTS after that
+// coefficients derived from the parameters are only recomputed when one of
+// their inputs actually moved
+//
+// continuous parameters that are not gains go through a Smoother at control
+// rate, one step per block
+//
+// a preset, a restored state, moves every parameter at once: the message
+// thread writes them inside a PresetWrite, then publishes the snapshot they
+// make, derived coefficients included, see SnapshotExchange
+// the blocks in between keep the previous snapshot and never see half a
+// preset, the first block after adopts the preset whole, decay included, no
+// glide from the old one
+class ParameterEngine {
+   public:
+    // immutable for the whole block
+    struct Snapshot {
+        float volume;
+        RenderEngine engine;
+        ModelId model;
+        float decayMs;  // smoothed
+        float glideCents;
+        float width;  // in [0, 1]
+        bool decorrelate;
+
+        // derived
+        // per sample coefficient of the master decay envelope
+        float masterDecay;
+        // relative frequency deviation at full amplitude, see Glide.hpp
+        float glideDepth;
+    };
+
+    explicit ParameterEngine(juce::AudioProcessorValueTreeState& params);
+
+    // the derived coefficients and the smoothers depend on it
+    void prepare(double sampleRate);
+
+    // audio thread, once per block of numSamples samples
+    const Snapshot& snapshot(int numSamples);
+
+    // message thread, the parameters are written while this lives
+    class PresetWrite {
+       public:
+        explicit PresetWrite(ParameterEngine& engine);
+        // publishes the snapshot of the parameters as they are now
+        ~PresetWrite();
+
+        PresetWrite(const PresetWrite&) = delete;
+        PresetWrite& operator=(const PresetWrite&) = delete;
+
+       private:
+        ParameterEngine& m_engine;
+    };
+
+   private:
+    // the raw values into snapshot, derived coefficients left alone
+    void read(Snapshot& snapshot) const;
+    // the parameters as they are, unsmoothed, derived coefficients included
+    Snapshot current() const;
+
+    std::atomic<float>* m_volume;
+    std::atomic<float>* m_engine;
+    std::atomic<float>* m_model;
+    std::atomic<float>* m_decayMs;
+    std::atomic<float>* m_glideCents;
+    std::atomic<float>* m_width;
+    std::atomic<float>* m_decorrelate;
+
+    double m_sampleRate = 44100.0;
+
+    Smoother m_decaySmoother;
+
+    Snapshot m_snapshot{};
+    // inputs of the derived coefficients as of their last computation,
+    // negative means stale
+    float m_derivedDecayMs = -1.0f;
+    float m_derivedGlideCents = -1.0f;
+
+    SnapshotExchange<Snapshot> m_presets;
+    // a preset is being written while they differ
+    std::atomic<std::uint32_t> m_presetWritesBegun{0};
+    std::atomic<std::uint32_t> m_presetWritesEnded{0};
+};
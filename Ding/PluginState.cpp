@@ -0,0 +1,76 @@
+#include "PluginState.hpp"
+
+#include <cmath>
+
+namespace {
+namespace impl {
+// "Ding" on disk, MemoryOutputStream is little endian
+static constexpr int magic = 'D' | 'i' << 8 | 'n' << 16 | 'g' << 24;
+
+// way more than there will ever be parameters, guards the reserve against
+// a garbage count
+static constexpr int maxValues = 1024;
+}  // namespace impl
+}  // namespace
+
+namespace PluginState {
+
+float State::valueOr(const juce::String& id, const float fallback) const
+{
+    for (const Value& value : values) {
+        if (value.id == id) {
+            return value.value;
+        }
+    }
+    return fallback;
+}
+
+void write(const State& state, juce::MemoryBlock& dest)
+{
+    juce::MemoryOutputStream out(dest, false);
+    out.writeInt(impl::magic);
+    out.writeInt(state.version);
+    out.writeInt(static_cast<int>(state.values.size()));
+    for (const Value& value : state.values) {
+        out.writeString(value.id);
+        out.writeFloat(value.value);
+    }
+}
+
+std::optional<State> read(const void* data, const int sizeInBytes)
+{
+    // the header, a stream past its end reads zeros
+    if (data == nullptr || sizeInBytes < 12) {
+        return std::nullopt;
+    }
+
+    juce::MemoryInputStream in(data, static_cast<std::size_t>(sizeInBytes),
+                               false);
+    if (in.readInt() != impl::magic) {
+        return std::nullopt;
+    }
+
+    State state{in.readInt(), {}};
+    const int nValues = in.readInt();
+    if (state.version < 1 || nValues < 0 || nValues > impl::maxValues) {
+        return std::nullopt;
+    }
+
+    state.values.reserve(static_cast<std::size_t>(nValues));
+    for (int i = 0; i < nValues; ++i) {
+        juce::String id = in.readString();
+        // readString stops at the end of the data as well as at the null
+        if (id.isEmpty() || in.getNumBytesRemaining() < 4) {
+            return std::nullopt;
+        }
+        const float value = in.readFloat();
+        if (!std::isfinite(value)) {
+            return std::nullopt;
+        }
+        state.values.push_back({std::move(id), value});
+    }
+
+    return state;
+}
+
+}  // namespace PluginState
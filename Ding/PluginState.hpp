@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <juce_core/juce_core.h>
+
+// what getStateInformation saves: the value of every parameter, by id
+//
+// "Ding", a version, the number of values, then an id and a float per value,
+// the denormalised value the parameter shows, a dozen bytes each
+// by id so parameters can come and go without breaking older sessions: the
+// reader skips the ids it doesn't know, and a parameter a session doesn't
+// have is left to its default
+// the layout stays, the version says what the values mean, for whatever
+// has to be migrated
+namespace PluginState {
+
+static constexpr int s_version = 1;
+
+struct Value {
+    juce::String id;
+    float value;
+};
+
+struct State {
+    int version;
+    std::vector<Value> values;
+
+    // fallback if the state doesn't have it
+    float valueOr(const juce::String& id, float fallback) const;
+};
+
+void write(const State& state, juce::MemoryBlock& dest);
+
+// nullopt for anything that isn't a state, or is damaged
+std::optional<State> read(const void* data, int sizeInBytes);
+
+}  // namespace PluginState
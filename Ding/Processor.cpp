@@ -9,12 +9,89 @@
 #include "Processor.hpp"
 
 #include "Gui/Editor.hpp"
-#include "Synth/Voice.hpp"
+#include "PluginState.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/Glide.hpp"
+#include "Synth/Pan.hpp"
+#include "core/VectorOps.hpp"
 
+#include <array>
 #include <cassert>
 
 const std::string DingProcessor::s_volume_id = "volume";
 const std::string DingProcessor::s_volume_name = "Volume";
+const std::string DingProcessor::s_engine_id = "engine";
+const std::string DingProcessor::s_engine_name = "Engine";
+const std::string DingProcessor::s_model_id = "model";
+const std::string DingProcessor::s_model_name = "Model";
+const std::string DingProcessor::s_decay_id = "decay";
+const std::string DingProcessor::s_decay_name = "Decay";
+const std::string DingProcessor::s_glide_id = "glide";
+const std::string DingProcessor::s_glide_name = "Pitch glide";
+const std::string DingProcessor::s_width_id = "width";
+const std::string DingProcessor::s_width_name = "Stereo width";
+const std::string DingProcessor::s_decorrelate_id = "decorrelate";
+const std::string DingProcessor::s_decorrelate_name = "Decorrelate modes";
+const std::string DingProcessor::s_polyphony_id = "polyphony";
+const std::string DingProcessor::s_polyphony_name = "Polyphony";
+const std::string DingProcessor::s_threads_id = "threads";
+const std::string DingProcessor::s_threads_name = "Render threads";
+
+namespace {
+namespace impl {
+// choices of the polyphony parameter, a long roll of ringing glockenspiel
+// notes gets stolen from well before 16
+static constexpr std::array<std::size_t, 6> polyphonies{16,  32,  64,
+                                                         128, 256, 512};
+static constexpr int defaultPolyphony = 2;  // 64 voices
+
+std::size_t polyphony(const float choice)
+{
+    return polyphonies[static_cast<std::size_t>(juce::jlimit(
+        0, static_cast<int>(polyphonies.size()) - 1,
+        juce::roundToInt(choice)))];
+}
+
+// choices of the render threads parameter, the audio thread included
+static constexpr int maxThreads = 8;
+
+// never more than there are cores, the workers would spin against each
+// other
+std::size_t threads(const float choice)
+{
+    return static_cast<std::size_t>(
+        juce::jlimit(1, juce::jmax(1, juce::SystemStats::getNumCpus()),
+                     1 + juce::roundToInt(choice)));
+}
+
+// the built-in instruments: a model and a decay that suits it, the other
+// parameters stay as they are
+// the tables of every model are built in prepareToPlay, a switch only moves
+// two parameters
+struct Program {
+    const char* name;
+    ModelId model;
+    float decayMs;
+};
+
+static constexpr std::array<Program, 6> programs{{
+    {"Glockenspiel", ModelId::glockenspiel, Decay::s_defaultMs},
+    {"Celesta", ModelId::celesta, 600.0f},
+    {"Vibraphone", ModelId::vibraphone, 4000.0f},
+    {"Marimba", ModelId::marimba, 350.0f},
+    {"Tubular bells", ModelId::tubularBell, 6000.0f},
+    {"Crotales", ModelId::crotales, 5000.0f},
+}};
+
+// not a parameter, saved along with them
+static constexpr const char* programId = "program";
+
+void setParameter(juce::RangedAudioParameter& parameter, const float value)
+{
+    parameter.setValueNotifyingHost(parameter.convertTo0to1(value));
+}
+}  // namespace impl
+}  // namespace
 
 juce::AudioProcessorValueTreeState::ParameterLayout
 DingProcessor::createParameterLayout()
@@ -26,70 +103,231 @@ DingProcessor::createParameterLayout()
         0.5f);
     params.push_back(std::move(volume_parameter));
 
+    // same order as RenderEngine
+    auto engine_parameter = std::make_unique<juce::AudioParameterChoice>(
+        s_engine_id, s_engine_name,
+        juce::StringArray{"Per voice", "Arena", "Time axis", "Damped",
+                          "Resonator"},
+        0,
+        juce::AudioParameterChoiceAttributes().withAutomatable(false));
+    params.push_back(std::move(engine_parameter));
+
+    // same order as ModelId
+    auto model_parameter = std::make_unique<juce::AudioParameterChoice>(
+        s_model_id, s_model_name,
+        juce::StringArray{"Glockenspiel lite", "Glockenspiel",
+                          "Glockenspiel hi-fi", "Celesta", "Vibraphone",
+                          "Marimba", "Tubular bell", "Crotales"},
+        static_cast<int>(ModelId::glockenspiel),
+        juce::AudioParameterChoiceAttributes().withAutomatable(false));
+    params.push_back(std::move(model_parameter));
+
+    // time to -30dB, see Synth/Decay.hpp
+    juce::NormalisableRange<float> decay_range(100.0f, 10000.0f, 1.0f);
+    decay_range.setSkewForCentre(1000.0f);
+    auto decay_parameter = std::make_unique<juce::AudioParameterFloat>(
+        s_decay_id, s_decay_name, decay_range, Decay::s_defaultMs,
+        juce::AudioParameterFloatAttributes().withLabel("ms"));
+    params.push_back(std::move(decay_parameter));
+
+    // pitch deviation of a mode at full amplitude, see Synth/Glide.hpp
+    auto glide_parameter = std::make_unique<juce::AudioParameterFloat>(
+        s_glide_id, s_glide_name,
+        juce::NormalisableRange<float>(0.0f, Glide::s_maxCents, 0.1f),
+        Glide::s_defaultCents,
+        juce::AudioParameterFloatAttributes().withLabel("cents"));
+    params.push_back(std::move(glide_parameter));
+
+    // how far apart the low and the high bars are, see Synth/Pan.hpp
+    auto width_parameter = std::make_unique<juce::AudioParameterFloat>(
+        s_width_id, s_width_name,
+        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
+        100.0f * Pan::s_defaultWidth,
+        juce::AudioParameterFloatAttributes().withLabel("%"));
+    params.push_back(std::move(width_parameter));
+
+    // the modes of a note spread around it, arena engine only
+    auto decorrelate_parameter = std::make_unique<juce::AudioParameterBool>(
+        s_decorrelate_id, s_decorrelate_name, false);
+    params.push_back(std::move(decorrelate_parameter));
+
+    // voices are allocated up front, see DingSynth::prepare, so this is not
+    // something to automate
+    juce::StringArray polyphony_choices;
+    for (const std::size_t nVoices : impl::polyphonies) {
+        polyphony_choices.add(juce::String(nVoices));
+    }
+    auto polyphony_parameter = std::make_unique<juce::AudioParameterChoice>(
+        s_polyphony_id, s_polyphony_name, polyphony_choices,
+        impl::defaultPolyphony,
+        juce::AudioParameterChoiceAttributes().withAutomatable(false));
+    params.push_back(std::move(polyphony_parameter));
+
+    // 1 renders everything on the audio thread, only worth it with lots of
+    // voices, see DingSynth
+    juce::StringArray threads_choices;
+    for (int nThreads = 1; nThreads <= impl::maxThreads; ++nThreads) {
+        threads_choices.add(juce::String(nThreads));
+    }
+    auto threads_parameter = std::make_unique<juce::AudioParameterChoice>(
+        s_threads_id, s_threads_name, threads_choices, 0,
+        juce::AudioParameterChoiceAttributes().withAutomatable(false));
+    params.push_back(std::move(threads_parameter));
+
     return {params.begin(), params.end()};
 }
 
 //==============================================================================
 DingProcessor::DingProcessor()
     : AudioProcessor(
-          BusesProperties().withOutput("Output",
-                                       juce::AudioChannelSet::stereo(),
-                                       true))
+          BusesProperties()
+              .withOutput("Output", juce::AudioChannelSet::stereo(), true)
+              // excites the held notes of the resonator engine
+              .withInput("Sidechain", juce::AudioChannelSet::stereo(), false))
 
       ,
       m_params(*this,
                nullptr,
                "PARAMETERS",
-               DingProcessor::createParameterLayout())
+               DingProcessor::createParameterLayout()),
+      m_parameters(m_params)
 {
     static_assert(std::atomic<float>::is_always_lock_free);
-
-    constexpr int nVoices = 16;
-    for (int _ = 0; _ < nVoices; ++_) {
-        m_synth.addVoice(new Voice());
-    }
-    m_synth.addSound(new SynthSound());
+    m_params.addParameterListener(s_polyphony_id, this);
+    m_params.addParameterListener(s_threads_id, this);
 }
 
-DingProcessor::~DingProcessor() = default;
+DingProcessor::~DingProcessor()
+{
+    m_params.removeParameterListener(s_polyphony_id, this);
+    m_params.removeParameterListener(s_threads_id, this);
+}
 
 void DingProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                                  juce::MidiBuffer& midiBuffer)
 {
+    process(buffer, midiBuffer);
+}
+
+void DingProcessor::processBlock(juce::AudioBuffer<double>& buffer,
+                                 juce::MidiBuffer& midiBuffer)
+{
+    process(buffer, midiBuffer);
+}
+
+// the per voice phasors follow the precision, see Synth/Voice.hpp
+bool DingProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename Sample>
+void DingProcessor::process(juce::AudioBuffer<Sample>& buffer,
+                            juce::MidiBuffer& midiBuffer)
+{
+    // FTZ/DAZ for the whole block, the kernels also flush their own levels,
+    // see Synth/Denormals.hpp
+    juce::ScopedNoDenormals noDenormals;
+
     const auto nSamples = buffer.getNumSamples();
 
-    buffer.clear();
+    const ParameterEngine::Snapshot& params = m_parameters.snapshot(nSamples);
+
+    m_synth.setEngine(params.engine);
+    m_synth.setModel(params.model);
+    m_synth.setMasterDecay(params.masterDecay);
+    m_synth.setGlideDepth(params.glideDepth);
+    m_synth.setStereo(params.width, params.decorrelate);
+    m_masterVolume.setTarget(params.volume);
 
+    // the on screen keyboard adds its notes here
     m_keyboardState.processNextMidiBuffer(midiBuffer, 0, nSamples, true);
 
+    // nothing rings and nothing starts: a cleared buffer and nothing else,
+    // an idle instance costs the snapshot and this
+    // a cleared buffer is flagged as such, see AudioBuffer::hasBeenCleared
+    if (m_synth.isSilent() && midiBuffer.isEmpty()) {
+        buffer.clear();
+        m_masterVolume.skip(nSamples);
+        return;
+    }
+
+    // the sidechain shares its channels with the output, grab it before
+    // clearing
+    m_synth.setExcitation(params.engine == RenderEngine::resonator
+                              ? mixDownSidechain(buffer)
+                              : nullptr);
+
+    buffer.clear();
+
     m_synth.renderNextBlock(buffer, midiBuffer, 0, buffer.getNumSamples());
 
-    auto* leftChannel = buffer.getWritePointer(0);
-    auto* rightChannel = buffer.getWritePointer(1);
+    m_masterVolume.applyGain(buffer, 0, nSamples);
+}
 
-    const float targetVolume = m_params.getRawParameterValue(s_volume_id)
-                                   ->load(std::memory_order_relaxed);
+template <typename Sample>
+const float* DingProcessor::mixDownSidechain(juce::AudioBuffer<Sample>& buffer)
+{
+    const auto sidechain = getBusBuffer(buffer, true, 0);
+    const int nChannels = sidechain.getNumChannels();
+    const int nSamples = sidechain.getNumSamples();
 
-    for (auto i = 0; i < nSamples; ++i) {
-        m_masterVolume =
-            targetVolume + m_volumeCoeff * (m_masterVolume - targetVolume);
-        leftChannel[i] *= m_masterVolume;
-        rightChannel[i] *= m_masterVolume;
+    if (nChannels == 0) {
+        return nullptr;
     }
+
+    // only allocates if the host goes over the announced block size
+    m_sidechain.setSize(1, nSamples, false, false, true);
+
+    m_sidechain.clear(0, nSamples);
+    float* mono = m_sidechain.getWritePointer(0);
+    for (int ch = 0; ch < nChannels; ++ch) {
+        VectorOps::add(mono, sidechain.getReadPointer(ch), nSamples);
+    }
+    m_sidechain.applyGain(1.0f / static_cast<float>(nChannels));
+
+    return m_sidechain.getReadPointer(0);
 }
 
 void DingProcessor::prepareToPlay(const double sampleRate,
-                                  const int /* samplesPerBlock */)
+                                  const int samplesPerBlock)
 {
-    m_synth.setCurrentPlaybackSampleRate(sampleRate);
+    m_parameters.prepare(sampleRate);
+    prepareSynth(sampleRate, samplesPerBlock);
+    m_sidechain.setSize(1, samplesPerBlock);
 
     const float smoothingTime = 0.02f;  // 20 ms
-    m_volumeCoeff =
-        std::exp(-1.0f / (smoothingTime * static_cast<float>(sampleRate)));
+    m_masterVolume.prepare(sampleRate, samplesPerBlock, smoothingTime);
 }
 
 void DingProcessor::releaseResources() {}
 
+void DingProcessor::prepareSynth(const double sampleRate,
+                                 const int samplesPerBlock)
+{
+    m_synth.prepare(
+        sampleRate, samplesPerBlock,
+        impl::polyphony(m_params.getRawParameterValue(s_polyphony_id)->load()),
+        impl::threads(m_params.getRawParameterValue(s_threads_id)->load()));
+}
+
+void DingProcessor::parameterChanged(const juce::String& parameterID,
+                                     const float newValue)
+{
+    // not automatable, so never the audio thread
+    // before the first prepareToPlay there is nothing to reallocate
+    (void)parameterID;
+    (void)newValue;
+    if (getSampleRate() <= 0.0) {
+        return;
+    }
+
+    // holds the callback lock, no processBlock runs until it's resumed
+    suspendProcessing(true);
+    prepareSynth(getSampleRate(), getBlockSize());
+    suspendProcessing(false);
+}
+
 //================== boiler plate =============================================
 
 const juce::String DingProcessor::getName() const
@@ -112,34 +350,53 @@ bool DingProcessor::isMidiEffect() const
     return false;
 }
 
+// a note rings on for as long as the decay says, the tail of the last one
+// a held resonator note fed by the sidechain has no tail to speak of, it
+// rings as long as the key is down
 double DingProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    const float decayMs = m_params.getRawParameterValue(s_decay_id)->load();
+    return Decay::tailMs(decayMs) / 1000.0;
 }
 
 int DingProcessor::getNumPrograms()
 {
-    return 1;  // NB: some hosts don't cope very well if you tell them there are
-               // 0 programs, so this should be at least 1, even if you're not
-               // really implementing programs.
+    return static_cast<int>(impl::programs.size());
 }
 
 int DingProcessor::getCurrentProgram()
 {
-    return 0;
+    return m_currentProgram;
 }
 
+// hosts also send the program changes of an automation lane through here,
+// on the message thread: the audio thread adopts the switch at its next
+// block, see ParameterEngine
 void DingProcessor::setCurrentProgram(const int index)
 {
-    (void)index;
+    if (index < 0 || index >= getNumPrograms()) {
+        return;
+    }
+
+    m_currentProgram = index;
+    const impl::Program& program =
+        impl::programs[static_cast<std::size_t>(index)];
+
+    const ParameterEngine::PresetWrite write(m_parameters);
+    impl::setParameter(*m_params.getParameter(s_model_id),
+                       static_cast<float>(program.model));
+    impl::setParameter(*m_params.getParameter(s_decay_id), program.decayMs);
 }
 
 const juce::String DingProcessor::getProgramName(const int index)
 {
-    (void)index;
-    return "Ding";
+    if (index < 0 || index >= getNumPrograms()) {
+        return {};
+    }
+    return impl::programs[static_cast<std::size_t>(index)].name;
 }
 
+// built-in, they keep their names
 void DingProcessor::changeProgramName(const int index,
                                       const juce::String& newName)
 {
@@ -152,7 +409,15 @@ void DingProcessor::changeProgramName(const int index,
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool DingProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
-    return layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
+    const auto sidechain = layouts.getMainInputChannelSet();
+    const bool sidechainSupported =
+        sidechain.isDisabled() ||
+        sidechain == juce::AudioChannelSet::mono() ||
+        sidechain == juce::AudioChannelSet::stereo();
+
+    return layouts.getMainOutputChannelSet() ==
+               juce::AudioChannelSet::stereo() &&
+           sidechainSupported;
 }
 #endif
 
@@ -170,21 +435,48 @@ juce::AudioProcessorEditor* DingProcessor::createEditor()
 }
 
 //==============================================================================
+// every parameter by id, see PluginState.hpp
 void DingProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
-    (void)destData;
+    PluginState::State state{PluginState::s_version, {}};
+    for (const auto* parameter : getParameters()) {
+        if (const auto* ranged =
+                dynamic_cast<const juce::RangedAudioParameter*>(parameter)) {
+            state.values.push_back(
+                {ranged->getParameterID(),
+                 ranged->convertFrom0to1(ranged->getValue())});
+        }
+    }
+    state.values.push_back(
+        {impl::programId, static_cast<float>(m_currentProgram)});
+    PluginState::write(state, destData);
 }
 
+// a preset as far as the audio thread is concerned, it may be playing
+// version 1 is the only one so far, nothing to migrate
 void DingProcessor::setStateInformation(const void* data, const int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory
-    // block, whose contents will have been created by the getStateInformation()
-    // call.
-    (void)data;
-    (void)sizeInBytes;
+    const auto state = PluginState::read(data, sizeInBytes);
+    if (!state) {
+        // not ours or damaged, better what we have than defaults
+        return;
+    }
+
+    // the parameters as saved, the program is only what it was called
+    m_currentProgram = juce::jlimit(
+        0, getNumPrograms() - 1,
+        juce::roundToInt(state->valueOr(impl::programId, 0.0f)));
+
+    const ParameterEngine::PresetWrite write(m_parameters);
+    for (auto* parameter : getParameters()) {
+        if (auto* ranged =
+                dynamic_cast<juce::RangedAudioParameter*>(parameter)) {
+            const float fallback =
+                ranged->convertFrom0to1(ranged->getDefaultValue());
+            impl::setParameter(
+                *ranged, state->valueOr(ranged->getParameterID(), fallback));
+        }
+    }
 }
 
 //==============================================================================
@@ -2,10 +2,16 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 
+#include "ParameterEngine.hpp"
+#include "core/Smoother.hpp"
+#include "Synth/DingSynth.hpp"
+
 //==============================================================================
 /**
  */
-class DingProcessor final : public juce::AudioProcessor {
+class DingProcessor final
+    : public juce::AudioProcessor,
+      private juce::AudioProcessorValueTreeState::Listener {
    public:
     //==============================================================================
     DingProcessor();
@@ -15,6 +21,8 @@ class DingProcessor final : public juce::AudioProcessor {
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
 #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
@@ -51,13 +59,47 @@ class DingProcessor final : public juce::AudioProcessor {
     juce::MidiKeyboardState m_keyboardState{};
 
    private:
-    juce::Synthesiser m_synth;
-    float m_masterVolume = 1.0f;
-    float m_volumeCoeff = 0.0f;
+    // polyphony and thread count changes reallocate the synth, processing
+    // is suspended meanwhile
+    void parameterChanged(const juce::String& parameterID,
+                          float newValue) override;
+    void prepareSynth(double sampleRate, int samplesPerBlock);
+
+    // both precisions, the synth renders straight into the host's buffer
+    template <typename Sample>
+    void process(juce::AudioBuffer<Sample>& buffer, juce::MidiBuffer& midi);
+
+    // mono mix of the sidechain input, nullptr if it is disabled
+    // float whatever the buffer, it only excites the resonators
+    template <typename Sample>
+    const float* mixDownSidechain(juce::AudioBuffer<Sample>& buffer);
+
+    ParameterEngine m_parameters;
+    // message thread, see setCurrentProgram
+    int m_currentProgram = 0;
+    DingSynth m_synth;
+    juce::AudioBuffer<float> m_sidechain;
+    Smoother m_masterVolume;
 
    public:
     static const std::string s_volume_id;
     static const std::string s_volume_name;
+    static const std::string s_engine_id;
+    static const std::string s_engine_name;
+    static const std::string s_model_id;
+    static const std::string s_model_name;
+    static const std::string s_decay_id;
+    static const std::string s_decay_name;
+    static const std::string s_glide_id;
+    static const std::string s_glide_name;
+    static const std::string s_width_id;
+    static const std::string s_width_name;
+    static const std::string s_decorrelate_id;
+    static const std::string s_decorrelate_name;
+    static const std::string s_polyphony_id;
+    static const std::string s_polyphony_name;
+    static const std::string s_threads_id;
+    static const std::string s_threads_name;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DingProcessor)
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cmath>
+
+#include <juce_core/juce_core.h>
+
+#include "Denormals.hpp"
+
+// a decaying sinusoid as a damped rotation
+//
+// same phasor as SineOscillator but the rotation matrix is scaled by the per
+// sample decay k, so the phasor spirals inwards and its magnitude _is_ the
+// level of the mode:
+// k cos th; -k sin th
+// k sin th;  k cos th
+//
+// no level state, no level multiply and no renorm: rounding only perturbs the
+// determinant by ~1e-7, i.e. the decay rate by a few parts in 10^8 which is
+// nowhere near audible, there is no unit circle to drift away from
+struct DampedModeOscillator {
+    // vector [x y], magnitude is the level
+    float m_cosv = 0.0f;
+    float m_sinv = 0.0f;
+
+    // unit rotation
+    float m_cosInc = 1.0f;
+    float m_sinInc = 0.0f;
+
+    // rotation scaled by the decay, the one actually applied
+    float m_dampedCosInc = 1.0f;
+    float m_dampedSinInc = 0.0f;
+
+    float m_sampleRate = 44100.0f;  // safeguard value but you should _really_
+                                    // call setSampleRate before doing anything
+
+    void setSampleRate(double sampleRate_)
+    {
+        m_sampleRate = static_cast<float>(sampleRate_);
+    }
+
+    // call setDecay afterwards, the damped matrix is only rebuilt there
+    void setFrequency(float freq)
+    {
+        const float phase_increment =
+            juce::MathConstants<float>::twoPi * freq / m_sampleRate;
+        m_cosInc = std::cos(phase_increment);
+        m_sinInc = std::sin(phase_increment);
+    }
+
+    // same with the rotation by the phase increment already computed
+    void setIncrement(float cosInc, float sinInc)
+    {
+        m_cosInc = cosInc;
+        m_sinInc = sinInc;
+    }
+
+    // per sample multiplier of the level
+    void setDecay(float decay)
+    {
+        m_dampedCosInc = decay * m_cosInc;
+        m_dampedSinInc = decay * m_sinInc;
+    }
+
+    // phase back to 0 with the given level
+    void reset(float level)
+    {
+        m_cosv = level;
+        m_sinv = 0.0f;
+    }
+
+    // impulse at phase 0 on top of the current state, the output stays
+    // continuous
+    void strike(float level) { m_cosv += level; }
+
+    // level * sin(phase)
+    float sin() const { return m_sinv; }
+
+    float level() const { return std::hypot(m_cosv, m_sinv); }
+
+    // call every Denormals::s_snapInterval samples
+    // |x| + |y| bounds the level, no need for a hypot
+    void snapToZero()
+    {
+        if (std::abs(m_cosv) + std::abs(m_sinv) < Denormals::s_levelFloor) {
+            m_cosv = 0.0f;
+            m_sinv = 0.0f;
+        }
+    }
+
+    void advance()
+    {
+        const float c = m_cosv * m_dampedCosInc - m_sinv * m_dampedSinInc;
+        const float s = m_sinv * m_dampedCosInc + m_cosv * m_dampedSinInc;
+
+        m_cosv = c;
+        m_sinv = s;
+    }
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "core/ConstexprMath.hpp"
+#include "core/Lookups.hpp"
+
+// master decay envelope
+//
+// adsr[n+1] = k * adsr[n]
+// ie adsr[n] = adsr[0] k^n = k^n
+namespace Decay {
+
+// the level at which the envelope has _significantly_ decayed
+// makes the decay time more of a tau time constant than a time to silence
+static constexpr float s_thresholdDecibel = -30.0f;
+
+static constexpr float s_defaultMs = 3000.0f;
+
+// a voice is silent below this and goes back to the voice pool
+static constexpr float s_silenceDecibel = -60.0f;
+
+// how long a note struck at full level rings before it is silent
+// no mode decays slower than the envelope, so the envelope is the tail
+constexpr float tailMs(const float decayMs)
+{
+    return decayMs * s_silenceDecibel / s_thresholdDecibel;
+}
+
+// we're looking for k such that adsr[n] = k^n = threshold
+// with n = decaySeconds * sampleRate
+// ie k = threshold^(1/n) = e^(ln(threshold) / n)
+//
+// e^x comes from a table, within a float ulp of std::pow, but there's still
+// a division: only call this when decayMs or the sample rate actually change
+inline float coefficient(const float decayMs, const double sampleRate)
+{
+    constexpr float logThreshold = static_cast<float>(
+        s_thresholdDecibel * ConstexprMath::s_ln10 / 20.0);
+
+    const float invDecaySamples =
+        1000.0f / (decayMs * static_cast<float>(sampleRate));
+    return Lookups::ExpDecay::evaluate(logThreshold * invDecaySamples);
+}
+
+}  // namespace Decay
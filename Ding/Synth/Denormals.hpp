@@ -0,0 +1,60 @@
+#pragma once
+
+#include <limits>
+
+#include "ModalModel.hpp"
+
+// explicit underflow to zero
+//
+// the processor sets FTZ/DAZ for the audio thread but the kernels don't rely
+// on it (offline renders, benches, whatever thread a host calls us from): a
+// decaying level would otherwise crawl through the subnormal range where
+// every multiply can take the slow path
+//
+// instead every kernel snaps its levels to exactly 0 once they fall below
+// s_levelFloor, at least every s_snapInterval samples
+namespace Denormals {
+
+// -400dB, nobody will miss it
+static constexpr float s_levelFloor = 1e-20f;
+static constexpr int s_snapInterval = 32;
+
+template <typename Model>
+constexpr float fastestDecay()
+{
+    float fastest = 1.0f;
+    for (const float decay : Model::relativeDecays) {
+        fastest = decay < fastest ? decay : fastest;
+    }
+    return fastest;
+}
+
+constexpr float power(float x, int n)
+{
+    float out = 1.0f;
+    for (int i = 0; i < n; ++i) {
+        out *= x;
+    }
+    return out;
+}
+
+// a level just above the floor must still be a normal float when the next
+// snap comes, even for the fastest mode of the model
+// the master decay is ~1 per sample and doesn't change the picture
+template <typename Model>
+constexpr bool snapsInTime()
+{
+    return s_levelFloor * power(fastestDecay<Model>(), s_snapInterval) >
+           std::numeric_limits<float>::min();
+}
+
+static_assert(snapsInTime<GlockenspielLiteModel>());
+static_assert(snapsInTime<GlockenspielModel>());
+static_assert(snapsInTime<GlockenspielHiFiModel>());
+static_assert(snapsInTime<CelestaModel>());
+static_assert(snapsInTime<VibraphoneModel>());
+static_assert(snapsInTime<MarimbaModel>());
+static_assert(snapsInTime<TubularBellModel>());
+static_assert(snapsInTime<CrotalesModel>());
+
+}  // namespace Denormals
@@ -0,0 +1,471 @@
+#include "DingSynth.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Decay.hpp"
+
+void DingSynth::prepare(const double sampleRate,
+                        const int maxBlockSize,
+                        const std::size_t nVoices,
+                        const std::size_t nThreads)
+{
+    jassert(nVoices > 0 && nVoices <= s_maxVoices);
+    jassert(nThreads > 0 && nThreads <= WorkerPool::s_maxThreads);
+
+    // fresh voices, none of them sounding
+    m_voices.clear();
+    m_voices.reserve(nVoices);
+    for (std::size_t i = 0; i < nVoices; ++i) {
+        m_voices.emplace_back(i);
+    }
+    m_voiceManager.prepare(nVoices);
+    m_sustainPedal.fill(false);
+
+    m_events.resize(s_maxEvents);
+    m_nEvents = 0;
+    m_firstEvent.assign(nVoices, nullptr);
+    m_lastEvent.assign(nVoices, nullptr);
+    m_scheduled.resize(nVoices);
+    m_nScheduled = 0;
+
+    m_workers.prepare(nThreads, 1000.0 * maxBlockSize / sampleRate);
+    m_threadScratch.resize(nThreads);
+    for (auto& scratch : m_threadScratch) {
+        scratch.setSize(2, maxBlockSize);
+    }
+    m_doubleThreadScratch.resize(nThreads);
+    for (auto& scratch : m_doubleThreadScratch) {
+        scratch.setSize(2, maxBlockSize);
+    }
+
+    m_arena.prepare(nVoices, maxBlockSize, nThreads);
+
+    m_noteTable.prepare(sampleRate);
+    for (Voice& voice : m_voices) {
+        voice.setSampleRate(sampleRate);
+        voice.setNoteTable(&m_noteTable);
+        voice.setMpeState(&m_mpe);
+        voice.setEngine(m_engine, &m_arena);
+        voice.setModel(m_model);
+        voice.setStereo(m_width, m_decorrelate);
+        voice.setGlideDepth(m_glideDepth);
+        voice.setDoublePrecision(m_doublePrecision);
+    }
+
+    // until someone says otherwise
+    m_masterDecay = -1.0f;
+    setMasterDecay(Decay::coefficient(Decay::s_defaultMs, sampleRate));
+}
+
+void DingSynth::renderNextBlock(juce::AudioBuffer<float>& outputAudio,
+                                const juce::MidiBuffer& midi,
+                                const int startSample,
+                                const int numSamples)
+{
+    setDoublePrecision(false);
+    m_output = &outputAudio;
+    renderBlock(midi, startSample, numSamples);
+    m_output = nullptr;
+}
+
+void DingSynth::renderNextBlock(juce::AudioBuffer<double>& outputAudio,
+                                const juce::MidiBuffer& midi,
+                                const int startSample,
+                                const int numSamples)
+{
+    setDoublePrecision(true);
+    m_doubleOutput = &outputAudio;
+    renderBlock(midi, startSample, numSamples);
+    m_doubleOutput = nullptr;
+}
+
+void DingSynth::renderBlock(const juce::MidiBuffer& midi,
+                            const int startSample,
+                            const int numSamples)
+{
+    const int end = startSample + numSamples;
+    m_rendered = startSample;
+
+    // every event first, the note events end up on their voices
+    for (auto it = midi.findNextSamplePosition(startSample); it != midi.cend();
+         ++it) {
+        const auto event = *it;
+        if (event.samplePosition >= end) {
+            break;
+        }
+        handleMidiEvent(event.getMessage(), event.samplePosition);
+    }
+
+    renderUpTo(end);
+}
+
+void DingSynth::setDoublePrecision(const bool doublePrecision)
+{
+    if (doublePrecision == m_doublePrecision) {
+        return;
+    }
+
+    // the voices keep their phasors in one precision or the other
+    stopAllNotes();
+    m_doublePrecision = doublePrecision;
+
+    for (Voice& voice : m_voices) {
+        voice.setDoublePrecision(doublePrecision);
+    }
+}
+
+void DingSynth::schedule(const std::size_t voice, const NoteEvent& event)
+{
+    if (m_engine == RenderEngine::arena) {
+        // a ringing note has to be rendered up to the event, a new one just
+        // waits for its first sample
+        Voice& v = m_voices[voice];
+        if (v.isActive()) {
+            renderUpTo(event.position);
+        }
+        v.apply(event);
+        if (event.position > m_rendered) {
+            m_arena.delay(voice, event.position - m_rendered);
+        }
+        return;
+    }
+
+    // noteOn made room
+    jassert(m_nEvents < m_events.size());
+    NoteEvent& scheduled = m_events[m_nEvents++];
+    scheduled = event;
+    scheduled.next = nullptr;
+
+    if (m_lastEvent[voice] == nullptr) {
+        m_firstEvent[voice] = &scheduled;
+        m_scheduled[m_nScheduled++] = voice;
+    } else {
+        m_lastEvent[voice]->next = &scheduled;
+    }
+    m_lastEvent[voice] = &scheduled;
+}
+
+void DingSynth::renderUpTo(const int position)
+{
+    jassert(position >= m_rendered);
+
+    // even an empty render applies the events on its first sample
+    if (m_doublePrecision) {
+        jassert(m_doubleOutput != nullptr);
+        renderVoices(*m_doubleOutput, m_rendered, position - m_rendered);
+    } else {
+        jassert(m_output != nullptr);
+        renderVoices(*m_output, m_rendered, position - m_rendered);
+    }
+    m_rendered = position;
+
+    for (std::size_t i = 0; i < m_nScheduled; ++i) {
+        m_firstEvent[m_scheduled[i]] = nullptr;
+        m_lastEvent[m_scheduled[i]] = nullptr;
+    }
+    m_nScheduled = 0;
+    m_nEvents = 0;
+}
+
+void DingSynth::setMasterDecay(const float masterDecay)
+{
+    if (masterDecay == m_masterDecay) {
+        return;
+    }
+
+    m_masterDecay = masterDecay;
+    // one log for every voice, their pressure damping is a table lookup
+    const float logMasterDecay = std::log(masterDecay);
+    for (Voice& voice : m_voices) {
+        voice.setMasterDecay(masterDecay, logMasterDecay);
+    }
+}
+
+void DingSynth::setGlideDepth(const float glideDepth)
+{
+    if (glideDepth == m_glideDepth) {
+        return;
+    }
+
+    m_glideDepth = glideDepth;
+    for (Voice& voice : m_voices) {
+        voice.setGlideDepth(glideDepth);
+    }
+}
+
+void DingSynth::setStereo(const float width, const bool decorrelate)
+{
+    if (width == m_width && decorrelate == m_decorrelate) {
+        return;
+    }
+
+    m_width = width;
+    m_decorrelate = decorrelate;
+    for (Voice& voice : m_voices) {
+        voice.setStereo(width, decorrelate);
+    }
+}
+
+void DingSynth::setEngine(const RenderEngine engine)
+{
+    if (engine == m_engine) {
+        return;
+    }
+
+    // the two engines don't share state, ringing notes can't migrate
+    stopAllNotes();
+    m_engine = engine;
+
+    for (Voice& voice : m_voices) {
+        voice.setEngine(engine, &m_arena);
+    }
+}
+
+void DingSynth::setModel(const ModelId model)
+{
+    if (model == m_model) {
+        return;
+    }
+
+    m_model = model;
+    for (Voice& voice : m_voices) {
+        voice.setModel(model);
+    }
+}
+
+void DingSynth::setExcitation(const float* excitation)
+{
+    m_excitation = excitation;
+}
+
+void DingSynth::noteOn(const int midiChannel,
+                       const int midiNoteNumber,
+                       const float velocity,
+                       const int position)
+{
+    NoteEvent event{NoteEvent::Type::start,
+                    position,
+                    midiChannel,
+                    midiNoteNumber,
+                    velocity,
+                    m_mpe.timbre(midiChannel),
+                    nullptr};
+
+    // a full pool is rendered before the voice manager hands out a voice,
+    // the render retires the voices that aren't active and a new one isn't
+    // yet
+    if (m_engine != RenderEngine::arena && m_nEvents == m_events.size()) {
+        renderUpTo(position);
+    }
+
+    // add energy to the bar that's already ringing
+    // a stolen voice just starts over, its note is gone
+    std::size_t voice = 0;
+    const int ringing = m_voiceManager.voiceFor(midiChannel, midiNoteNumber);
+    if (ringing != VoiceManager::s_noVoice) {
+        voice = static_cast<std::size_t>(ringing);
+        event.type = NoteEvent::Type::restrike;
+    } else {
+        voice = m_voiceManager.allocate(midiChannel, midiNoteNumber).voice;
+    }
+
+    m_voices[voice].setKeyDown(true);
+    m_voices[voice].setSustained(false);
+    schedule(voice, event);
+}
+
+void DingSynth::noteOff(const int midiChannel, const int midiNoteNumber)
+{
+    const int ringing = m_voiceManager.voiceFor(midiChannel, midiNoteNumber);
+    if (ringing == VoiceManager::s_noVoice) {
+        return;
+    }
+
+    // the note rings on, only the resonator engine cares about the key
+    Voice& voice = m_voices[static_cast<std::size_t>(ringing)];
+    voice.setKeyDown(false);
+    voice.setSustained(m_sustainPedal[static_cast<std::size_t>(midiChannel)]);
+}
+
+void DingSynth::stopAllNotes()
+{
+    m_voiceManager.forEachSounding([&](const std::size_t v) {
+        m_voices[v].stop();
+        m_voiceManager.retire(v);
+    });
+    m_sustainPedal.fill(false);
+}
+
+void DingSynth::handleMidiEvent(const juce::MidiMessage& message,
+                                const int position)
+{
+    // first so a note on sees the expression of its channel
+    m_mpe.processMidi(message);
+
+    const int channel = message.getChannel();
+    if (message.isNoteOn()) {
+        noteOn(channel, message.getNoteNumber(), message.getFloatVelocity(),
+               position);
+    } else if (message.isNoteOff()) {
+        noteOff(channel, message.getNoteNumber());
+    } else if (message.isAllSoundOff()) {
+        stopChannel(channel, position);
+    } else if (message.isAllNotesOff()) {
+        releaseChannel(channel);
+    } else if (message.isSustainPedalOn()) {
+        setSustainPedal(channel, true);
+    } else if (message.isSustainPedalOff()) {
+        setSustainPedal(channel, false);
+    }
+}
+
+// a pedal or a panic message touches every note of a channel, these are the
+// only events that are not O(1)
+// the voice manager knows the notes that haven't started yet, the voices
+// don't
+void DingSynth::setSustainPedal(const int midiChannel, const bool down)
+{
+    m_sustainPedal[static_cast<std::size_t>(midiChannel)] = down;
+    if (down) {
+        return;
+    }
+
+    m_voiceManager.forEachSounding([&](const std::size_t v) {
+        if (m_voiceManager.channel(v) == midiChannel) {
+            m_voices[v].setSustained(false);
+        }
+    });
+}
+
+void DingSynth::releaseChannel(const int midiChannel)
+{
+    m_sustainPedal[static_cast<std::size_t>(midiChannel)] = false;
+    m_voiceManager.forEachSounding([&](const std::size_t v) {
+        if (m_voiceManager.channel(v) == midiChannel) {
+            m_voices[v].setKeyDown(false);
+            m_voices[v].setSustained(false);
+        }
+    });
+}
+
+// a panic, so the one event that cuts the block: everything before it is
+// rendered, then the notes stop
+void DingSynth::stopChannel(const int midiChannel, const int position)
+{
+    renderUpTo(position);
+    m_voiceManager.forEachSounding([&](const std::size_t v) {
+        if (m_voiceManager.channel(v) == midiChannel) {
+            m_voices[v].stop();
+            m_voiceManager.retire(v);
+        }
+    });
+}
+
+template <typename Sample>
+void DingSynth::renderVoices(juce::AudioBuffer<Sample>& outputAudio,
+                             const int startSample,
+                             const int numSamples)
+{
+    const bool parallel =
+        m_workers.size() > 1 &&
+        m_voiceManager.nSounding() >= s_minParallelVoices &&
+        startSample + numSamples <= m_threadScratch[0].getNumSamples();
+
+    if (m_engine == RenderEngine::arena) {
+        m_voiceManager.forEachSounding(
+            [&](const std::size_t v) { m_voices[v].updateExpression(); });
+
+        m_arena.render(outputAudio, startSample, numSamples, m_masterDecay,
+                       parallel ? &m_workers : nullptr);
+
+        m_voiceManager.forEachSounding(
+            [&](const std::size_t v) { m_voices[v].syncWithArena(); });
+    } else {
+        const float* excitation =
+            m_excitation != nullptr ? m_excitation + startSample : nullptr;
+        if (parallel) {
+            renderVoicesInParallel(outputAudio, startSample, numSamples,
+                                   excitation);
+        } else {
+            // a voice with a pending note is already sounding for the voice
+            // manager
+            m_voiceManager.forEachSounding([&](const std::size_t v) {
+                renderVoice(v, outputAudio, startSample, numSamples,
+                            excitation);
+            });
+        }
+    }
+
+    updateVoiceManager();
+}
+
+template <typename Sample>
+void DingSynth::renderVoicesInParallel(juce::AudioBuffer<Sample>& outputAudio,
+                                       const int startSample,
+                                       const int numSamples,
+                                       const float* excitation)
+{
+    auto& scratch = threadScratch<Sample>();
+    const std::size_t nThreads = m_workers.size();
+    for (std::size_t t = 0; t < nThreads; ++t) {
+        scratch[t].clear(startSample, numSamples);
+    }
+
+    // voices only read what they share, the note table and the mpe state,
+    // and every thread writes in its own scratch
+    const std::uint16_t* voices = m_voiceManager.sounding();
+    const std::size_t nVoices = m_voiceManager.nSounding();
+    auto job = [&](const std::size_t index, const std::size_t thread) {
+        const std::size_t end = std::min(nVoices, (index + 1) * s_voicesPerJob);
+        for (std::size_t i = index * s_voicesPerJob; i < end; ++i) {
+            renderVoice(voices[i], scratch[thread], startSample,
+                        numSamples, excitation);
+        }
+    };
+    m_workers.run((nVoices + s_voicesPerJob - 1) / s_voicesPerJob, job);
+
+    // the reduction, the scratches are stereo whatever the output is, the
+    // same way a voice folds its pan on a mono output
+    const int channels = outputAudio.getNumChannels();
+    for (std::size_t t = 0; t < nThreads; ++t) {
+        if (channels == 1) {
+            outputAudio.addFrom(0, startSample, scratch[t], 0, startSample,
+                                numSamples, Sample(0.5));
+            outputAudio.addFrom(0, startSample, scratch[t], 1, startSample,
+                                numSamples, Sample(0.5));
+            continue;
+        }
+        for (int ch = 0; ch < channels; ++ch) {
+            outputAudio.addFrom(ch, startSample, scratch[t], ch % 2,
+                                startSample, numSamples);
+        }
+    }
+}
+
+template <typename Sample>
+void DingSynth::renderVoice(const std::size_t voice,
+                            juce::AudioBuffer<Sample>& outputAudio,
+                            const int startSample,
+                            const int numSamples,
+                            const float* excitation)
+{
+    if (m_engine == RenderEngine::resonator) {
+        m_voices[voice].renderResonator(outputAudio, startSample, numSamples,
+                                        m_firstEvent[voice], excitation);
+    } else {
+        m_voices[voice].renderNextBlock(outputAudio, startSample, numSamples,
+                                        m_firstEvent[voice]);
+    }
+}
+
+void DingSynth::updateVoiceManager()
+{
+    m_voiceManager.forEachSounding([&](const std::size_t v) {
+        if (m_voices[v].isActive()) {
+            m_voiceManager.setAmplitude(v, m_voices[v].amplitude());
+        } else {
+            m_voiceManager.retire(v);
+        }
+    });
+}
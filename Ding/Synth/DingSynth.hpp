@@ -0,0 +1,232 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#include "ModalArena.hpp"
+#include "MpeState.hpp"
+#include "NoteTable.hpp"
+#include "Pan.hpp"
+#include "RenderEngine.hpp"
+#include "Voice.hpp"
+#include "VoiceManager.hpp"
+#include "WorkerPool.hpp"
+
+// the polyphonic synth: MIDI in, Ding voices out
+//
+// the per voice engines let every voice render itself through its own
+// ModalBank, the arena engine renders the modes of every active voice in one
+// kernel over a shared ModalArena
+//
+// a note that is still ringing is struck again instead of getting a second
+// voice, in every engine, see Voice::restrike
+// when every voice is busy the least audible one is stolen, see VoiceManager
+// in the resonator engine held notes are also excited by the audio passed to
+// setExcitation
+//
+// pitch bend, pressure and timbre are tracked per channel by an MpeState,
+// so an MPE controller gets per note expression and a plain keyboard gets
+// channel wide bend
+//
+// MIDI is sample accurate without cutting the block at every event: the
+// events of a block are handled first and the note events are scheduled on
+// their voices, then every voice renders the whole block in one call and
+// only splits it at its own events, see NoteEvent
+// the arena starts a note inside the block with ModalArena::delay, only a
+// restrike or a steal of a ringing note cuts its render
+// all sound off cuts the block in every engine, it's a panic
+// expression is control rate, whatever the block ends with applies to the
+// whole block
+//
+// voices render mono and place the note in the stereo field as they add it
+// to the output, a 64 sample chunk at a time, see Pan.hpp
+//
+// polyphony is only a matter of memory: every loop over voices goes through
+// the sounding ones, see VoiceManager::forEachSounding, an idle voice costs
+// nothing per block
+//
+// with more than one render thread, enough sounding voices are split over a
+// WorkerPool: the per voice engines render groups of voices in a stereo
+// scratch per thread, the arena splits its slots the same way, and the
+// scratches are added to the output once the pool is done
+// below s_minParallelVoices waking the workers costs more than it saves,
+// the audio thread renders alone
+//
+// the output is float or double, the synth renders in the precision of the
+// buffers it is handed, see Voice for what that changes
+// switching precision stops every note, hosts only do it between two
+// prepareToPlay
+//
+// nothing here locks or allocates once prepared, the synth belongs to the
+// audio thread
+class DingSynth final {
+   public:
+    static constexpr std::size_t s_defaultVoices = 64;
+    static constexpr std::size_t s_maxVoices = 1024;
+    static constexpr std::size_t s_minParallelVoices = 32;
+
+    // allocates the voices, the arena and builds the note table for this
+    // sample rate, stops every note
+    // nThreads counts the audio thread, 1 renders everything on it
+    // call it off the audio thread
+    void prepare(double sampleRate,
+                 int maxBlockSize,
+                 std::size_t nVoices = s_defaultVoices,
+                 std::size_t nThreads = 1);
+
+    std::size_t getNumVoices() const { return m_voices.size(); }
+
+    // no voice sounding: until a note on, every block is silence
+    bool isSilent() const { return m_voiceManager.nSounding() == 0; }
+
+    // adds the next numSamples samples to outputAudio from startSample on
+    // the note events of midi start on their sample
+    void renderNextBlock(juce::AudioBuffer<float>& outputAudio,
+                         const juce::MidiBuffer& midi,
+                         int startSample,
+                         int numSamples);
+    void renderNextBlock(juce::AudioBuffer<double>& outputAudio,
+                         const juce::MidiBuffer& midi,
+                         int startSample,
+                         int numSamples);
+
+    // stops every note if the engine actually changes
+    void setEngine(RenderEngine engine);
+    RenderEngine getEngine() const { return m_engine; }
+
+    // the next notes play model, the ringing ones ring on with theirs, in
+    // every engine
+    void setModel(ModelId model);
+    ModelId getModel() const { return m_model; }
+
+    // per sample coefficient of the master decay envelope, see Decay.hpp
+    // cheap when it doesn't change, call it every block
+    void setMasterDecay(float masterDecay);
+
+    // relative frequency deviation of a mode at full amplitude, see
+    // Glide.hpp, 0 is off
+    // only the perVoice engine glides
+    void setGlideDepth(float glideDepth);
+
+    // stereo width of the notes in [0, 1], 0 is mono
+    // decorrelate spreads the modes of a note around it, only the arena
+    // engine does, see Voice::setStereo
+    // cheap when it doesn't change, call it every block
+    void setStereo(float width, bool decorrelate);
+
+    // resonator engine: one mono sample per sample of the next block, or
+    // nullptr for no excitation
+    // the pointer must stay valid until renderNextBlock returns
+    void setExcitation(const float* excitation);
+
+    // every voice silent right away, not while rendering
+    void stopAllNotes();
+
+   private:
+    // at most this many note events are pending, past that the block gets
+    // rendered up to the next note on, which only a MIDI flood can cause
+    static constexpr std::size_t s_maxEvents = 256;
+
+    // renderNextBlock once the output of the current precision is set
+    void renderBlock(const juce::MidiBuffer& midi,
+                     int startSample,
+                     int numSamples);
+    // stops every note if the precision actually changes
+    void setDoublePrecision(bool doublePrecision);
+
+    // position is the sample of the event in the output buffer
+    void handleMidiEvent(const juce::MidiMessage& message, int position);
+    void noteOn(int midiChannel,
+                int midiNoteNumber,
+                float velocity,
+                int position);
+    void noteOff(int midiChannel, int midiNoteNumber);
+    void setSustainPedal(int midiChannel, bool down);
+    // all notes off: the keys of the channel go up, notes ring on
+    void releaseChannel(int midiChannel);
+    // all sound off: the notes of the channel stop
+    void stopChannel(int midiChannel, int position);
+
+    // per voice engines: queues the event on the voice
+    // arena: applies it right away, after rendering up to it if the voice
+    // is ringing
+    void schedule(std::size_t voice, const NoteEvent& event);
+    // renders the block being rendered up to position, with the events
+    // scheduled so far
+    void renderUpTo(int position);
+
+    template <typename Sample>
+    void renderVoices(juce::AudioBuffer<Sample>& outputAudio,
+                      int startSample,
+                      int numSamples);
+    // the per voice engines, on the pool
+    template <typename Sample>
+    void renderVoicesInParallel(juce::AudioBuffer<Sample>& outputAudio,
+                                int startSample,
+                                int numSamples,
+                                const float* excitation);
+    template <typename Sample>
+    void renderVoice(std::size_t voice,
+                     juce::AudioBuffer<Sample>& outputAudio,
+                     int startSample,
+                     int numSamples,
+                     const float* excitation);
+    // after rendering: silent voices go back to the voice manager, the
+    // others tell it how loud they are now
+    void updateVoiceManager();
+
+    // a job of the per voice engines
+    static constexpr std::size_t s_voicesPerJob = 4;
+
+    std::vector<Voice> m_voices;
+    VoiceManager m_voiceManager;
+
+    WorkerPool m_workers;
+    // one stereo buffer per thread and per precision
+    std::vector<juce::AudioBuffer<float>> m_threadScratch;
+    std::vector<juce::AudioBuffer<double>> m_doubleThreadScratch;
+
+    template <typename Sample>
+    std::vector<juce::AudioBuffer<Sample>>& threadScratch()
+    {
+        if constexpr (std::is_same_v<Sample, double>) {
+            return m_doubleThreadScratch;
+        } else {
+            return m_threadScratch;
+        }
+    }
+
+    // the block being rendered, only valid in renderNextBlock, the one of
+    // the current precision
+    juce::AudioBuffer<float>* m_output = nullptr;
+    juce::AudioBuffer<double>* m_doubleOutput = nullptr;
+    int m_rendered = 0;
+
+    // pending note events, linked per voice in order
+    std::vector<NoteEvent> m_events;
+    std::size_t m_nEvents = 0;
+    std::vector<NoteEvent*> m_firstEvent;
+    std::vector<NoteEvent*> m_lastEvent;
+    // voices with pending events
+    std::vector<std::size_t> m_scheduled;
+    std::size_t m_nScheduled = 0;
+
+    // indexed by midi channel, 0 is unused
+    std::array<bool, 17> m_sustainPedal{};
+
+    RenderEngine m_engine = RenderEngine::perVoice;
+    ModelId m_model = ModelId::glockenspiel;
+    ModalArena m_arena;
+    NoteTable m_noteTable;
+    MpeState m_mpe;
+    float m_masterDecay = 1.0f;
+    float m_glideDepth = 0.0f;
+    bool m_doublePrecision = false;
+    float m_width = Pan::s_defaultWidth;
+    bool m_decorrelate = false;
+    const float* m_excitation = nullptr;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cmath>
+
+// amplitude dependent pitch glide, aka tension modulation
+//
+// a bar struck hard stretches a little, its modes start sharp and glide down
+// to their nominal pitch as they decay
+// a mode of amplitude a runs at (1 + depth a^2) times its frequency, the glide
+// parameter is that deviation at full amplitude, in cents
+namespace Glide {
+
+static constexpr float s_maxCents = 50.0f;
+// off, the static kernel runs
+static constexpr float s_defaultCents = 0.0f;
+
+// relative frequency deviation at full amplitude
+//
+// an exp2, only call this when the parameter actually changes
+inline float depth(const float cents)
+{
+    return std::exp2(cents / 1200.0f) - 1.0f;
+}
+
+}  // namespace Glide
@@ -0,0 +1,371 @@
+#include "ModalArena.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Denormals.hpp"
+#include "core/VectorOps.hpp"
+
+void ModalArena::prepare(const std::size_t nVoices,
+                         const int maxBlockSize,
+                         const std::size_t nThreads)
+{
+    m_nVoices = nVoices;
+    m_nActive = 0;
+
+    // round every field up to whole cache lines
+    constexpr std::size_t regsPerLine =
+        std::max<std::size_t>(1, s_cacheLine / sizeof(Register));
+    const std::size_t regsPerField =
+        (nVoices * s_regsPerSlot + regsPerLine - 1) / regsPerLine *
+        regsPerLine;
+
+    const std::size_t bytes = s_nFields * regsPerField * sizeof(Register);
+    m_storage.reset(static_cast<Register*>(
+        ::operator new(bytes, std::align_val_t{s_cacheLine})));
+
+    m_cos = m_storage.get();
+    m_sin = m_cos + regsPerField;
+    m_cosInc = m_sin + regsPerField;
+    m_sinInc = m_cosInc + regsPerField;
+    m_level = m_sinInc + regsPerField;
+    m_decay = m_level + regsPerField;
+    m_panLeft = m_decay + regsPerField;
+    m_panRight = m_panLeft + regsPerField;
+
+    m_slotOfVoice.assign(nVoices, s_noSlot);
+    m_voiceOfSlot.assign(nVoices, s_noSlot);
+    m_amplitude.assign(nVoices, 0.0f);
+    m_regsOfSlot.assign(nVoices, 0);
+    m_begin.assign(nVoices, 0);
+
+    m_chunkSize = static_cast<std::size_t>(std::max(maxBlockSize, 1));
+    m_nThreads = std::max<std::size_t>(nThreads, 1);
+    m_scratch.resize(m_nThreads * 2 * m_chunkSize);
+    m_mixLeft.resize(m_chunkSize);
+    m_mixRight.resize(m_chunkSize);
+}
+
+void ModalArena::start(const std::size_t voice, const ModeParameters& modes)
+{
+    jassert(voice < m_nVoices);
+    jassert(modes.nModes <= s_maxModes);
+
+    // a re-triggered voice keeps its slot
+    std::size_t slot = m_slotOfVoice[voice];
+    if (slot == s_noSlot) {
+        slot = m_nActive++;
+        m_slotOfVoice[voice] = slot;
+        m_voiceOfSlot[slot] = voice;
+    }
+
+    const std::size_t base = slot * s_regsPerSlot;
+    const std::size_t nRegs = registersFor(modes.nModes);
+    m_regsOfSlot[slot] = nRegs;
+    float amplitude = 0.0f;
+
+    for (std::size_t r = 0; r < nRegs; ++r) {
+        // padding lanes are silent identity rotations
+        m_cos[base + r] = 1.0f;
+        m_sin[base + r] = 0.0f;
+        m_cosInc[base + r] = 1.0f;
+        m_sinInc[base + r] = 0.0f;
+        m_level[base + r] = 0.0f;
+        m_decay[base + r] = 0.0f;
+        m_panLeft[base + r] = 1.0f;
+        m_panRight[base + r] = 1.0f;
+    }
+
+    for (std::size_t i = 0; i < modes.nModes; ++i) {
+        const std::size_t r = base + i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+
+        m_cosInc[r].set(lane, static_cast<float>(modes.cosIncs[i]));
+        m_sinInc[r].set(lane, static_cast<float>(modes.sinIncs[i]));
+        m_level[r].set(lane, modes.levels[i]);
+        m_decay[r].set(lane, modes.relativeDecays[i]);
+        amplitude += modes.levels[i];
+    }
+
+    m_amplitude[slot] = amplitude;
+    m_begin[slot] = 0;
+}
+
+void ModalArena::stop(const std::size_t voice)
+{
+    jassert(voice < m_nVoices);
+
+    const std::size_t slot = m_slotOfVoice[voice];
+    if (slot == s_noSlot) {
+        return;
+    }
+
+    // keep the active slots packed: the last one fills the hole
+    const std::size_t last = --m_nActive;
+    if (slot != last) {
+        moveSlot(last, slot);
+    }
+
+    m_slotOfVoice[voice] = s_noSlot;
+    m_voiceOfSlot[last] = s_noSlot;
+}
+
+void ModalArena::strike(const std::size_t voice,
+                        const std::array<float, s_maxModes>& levels)
+{
+    jassert(voice < m_nVoices);
+
+    const std::size_t slot = m_slotOfVoice[voice];
+    if (slot == s_noSlot) {
+        return;
+    }
+
+    const std::size_t base = slot * s_regsPerSlot;
+    float amplitude = 0.0f;
+    for (std::size_t r = 0; r < m_regsOfSlot[slot]; ++r) {
+        alignas(s_cacheLine) std::array<float, s_laneWidth> c;
+        alignas(s_cacheLine) std::array<float, s_laneWidth> s;
+        alignas(s_cacheLine) std::array<float, s_laneWidth> level;
+        m_cos[base + r].copyToRawArray(c.data());
+        m_sin[base + r].copyToRawArray(s.data());
+        m_level[base + r].copyToRawArray(level.data());
+
+        // padding lanes have nothing to add
+        for (std::size_t lane = 0; lane < s_laneWidth; ++lane) {
+            const std::size_t j = r * s_laneWidth + lane;
+            const float strike = j < s_maxModes ? levels[j] : 0.0f;
+            const float x = level[lane] * c[lane] + strike;
+            const float y = level[lane] * s[lane];
+            const float sum = std::hypot(x, y);
+            if (sum > 0.0f) {
+                c[lane] = x / sum;
+                s[lane] = y / sum;
+                level[lane] = sum;
+            }
+            amplitude += level[lane];
+        }
+
+        m_cos[base + r] = Register::fromRawArray(c.data());
+        m_sin[base + r] = Register::fromRawArray(s.data());
+        m_level[base + r] = Register::fromRawArray(level.data());
+    }
+
+    m_amplitude[slot] = amplitude;
+}
+
+void ModalArena::delay(const std::size_t voice, const int samples)
+{
+    jassert(voice < m_nVoices);
+
+    const std::size_t slot = m_slotOfVoice[voice];
+    if (slot != s_noSlot) {
+        m_begin[slot] = samples;
+    }
+}
+
+bool ModalArena::isActive(const std::size_t voice) const
+{
+    return m_slotOfVoice[voice] != s_noSlot;
+}
+
+float ModalArena::amplitude(const std::size_t voice) const
+{
+    const std::size_t slot = m_slotOfVoice[voice];
+    return slot == s_noSlot ? 0.0f : m_amplitude[slot];
+}
+
+void ModalArena::moveSlot(const std::size_t from, const std::size_t to)
+{
+    for (std::size_t r = 0; r < m_regsOfSlot[from]; ++r) {
+        const std::size_t src = from * s_regsPerSlot + r;
+        const std::size_t dst = to * s_regsPerSlot + r;
+        m_cos[dst] = m_cos[src];
+        m_sin[dst] = m_sin[src];
+        m_cosInc[dst] = m_cosInc[src];
+        m_sinInc[dst] = m_sinInc[src];
+        m_level[dst] = m_level[src];
+        m_decay[dst] = m_decay[src];
+        m_panLeft[dst] = m_panLeft[src];
+        m_panRight[dst] = m_panRight[src];
+    }
+    m_amplitude[to] = m_amplitude[from];
+    m_regsOfSlot[to] = m_regsOfSlot[from];
+    m_begin[to] = m_begin[from];
+
+    const std::size_t voice = m_voiceOfSlot[from];
+    m_voiceOfSlot[to] = voice;
+    m_slotOfVoice[voice] = to;
+}
+
+template <typename Sample>
+void ModalArena::render(juce::AudioBuffer<Sample>& outputBuffer,
+                        const int startSample,
+                        const int numSamples,
+                        const float masterDecay,
+                        WorkerPool* const workers)
+{
+    if (m_nActive == 0) {
+        return;
+    }
+
+    const int chunkSize = static_cast<int>(m_chunkSize);
+    const int channels = outputBuffer.getNumChannels();
+
+    // hosts are allowed to send blocks larger than announced
+    for (int done = 0; done < numSamples; done += chunkSize) {
+        const int n = std::min(chunkSize, numSamples - done);
+
+        renderChunk(m_mixLeft.data(), m_mixRight.data(), done, n,
+                    masterDecay, workers);
+
+        if (channels == 1) {
+            Sample* out = outputBuffer.getWritePointer(0, startSample + done);
+            VectorOps::addWithMultiply(out, m_mixLeft.data(), Sample(0.5), n);
+            VectorOps::addWithMultiply(out, m_mixRight.data(), Sample(0.5),
+                                       n);
+            continue;
+        }
+        for (int ch = 0; ch < channels; ++ch) {
+            VectorOps::add(
+                outputBuffer.getWritePointer(ch, startSample + done),
+                ch % 2 == 0 ? m_mixLeft.data() : m_mixRight.data(), n);
+        }
+    }
+
+    // every delayed note has started by now
+    std::fill(m_begin.begin(), m_begin.begin() + m_nActive, 0);
+}
+
+// the precisions DingSynth renders in
+template void ModalArena::render(juce::AudioBuffer<float>&,
+                                 int,
+                                 int,
+                                 float,
+                                 WorkerPool*);
+template void ModalArena::render(juce::AudioBuffer<double>&,
+                                 int,
+                                 int,
+                                 float,
+                                 WorkerPool*);
+
+void ModalArena::renderChunk(float* left,
+                             float* right,
+                             const int chunkStart,
+                             const int numSamples,
+                             const float masterDecay,
+                             WorkerPool* const workers)
+{
+    const auto n = static_cast<std::size_t>(numSamples);
+    const std::size_t nJobs = (m_nActive + s_slotsPerJob - 1) / s_slotsPerJob;
+    const std::size_t nThreads =
+        workers != nullptr && nJobs > 1 ? std::min(workers->size(), m_nThreads)
+                                        : 1;
+
+    // a thread's scratch is its left chunk then its right one
+    const std::size_t stride = 2 * m_chunkSize;
+    for (std::size_t t = 0; t < nThreads; ++t) {
+        Register* scratch = m_scratch.data() + t * stride;
+        std::fill(scratch, scratch + numSamples, Register(0.0f));
+        std::fill(scratch + m_chunkSize, scratch + m_chunkSize + numSamples,
+                  Register(0.0f));
+    }
+
+    if (nThreads == 1) {
+        renderSlots(m_scratch.data(), 0, m_nActive, chunkStart, numSamples,
+                    masterDecay);
+    } else {
+        // a pool with more threads than scratches leaves the extra ones
+        // idle, they never get a job
+        auto job = [&](const std::size_t index, const std::size_t thread) {
+            jassert(thread < nThreads);
+            const std::size_t first = index * s_slotsPerJob;
+            renderSlots(m_scratch.data() + thread * stride, first,
+                        std::min(m_nActive, first + s_slotsPerJob),
+                        chunkStart, numSamples, masterDecay);
+        };
+        workers->run(nJobs, job);
+    }
+
+    // the reduction, lanes and threads in one go
+    for (std::size_t i = 0; i < n; ++i) {
+        Register sumLeft = m_scratch[i];
+        Register sumRight = m_scratch[m_chunkSize + i];
+        for (std::size_t t = 1; t < nThreads; ++t) {
+            sumLeft += m_scratch[t * stride + i];
+            sumRight += m_scratch[t * stride + m_chunkSize + i];
+        }
+        left[i] = sumLeft.sum();
+        right[i] = sumRight.sum();
+    }
+}
+
+void ModalArena::renderSlots(Register* const scratch,
+                             const std::size_t firstSlot,
+                             const std::size_t endSlot,
+                             const int chunkStart,
+                             const int numSamples,
+                             const float masterDecay)
+{
+    const auto n = static_cast<std::size_t>(numSamples);
+
+    const Register threeHalves(1.5f);
+    const Register minusHalf(-0.5f);
+    const Register floor(Denormals::s_levelFloor);
+    const auto snapInterval =
+        static_cast<std::size_t>(Denormals::s_snapInterval);
+
+    // registers outside, time inside: the whole state of a register stays in
+    // cpu registers for the chunk and the lanes of every voice are treated
+    // the same way
+    // a delayed voice starts its time loop later, which is all a note on
+    // inside the block costs
+    Register* const left = scratch;
+    Register* const right = scratch + m_chunkSize;
+
+    for (std::size_t slot = firstSlot; slot < endSlot; ++slot) {
+        const auto begin = static_cast<std::size_t>(
+            std::clamp(m_begin[slot] - chunkStart, 0, numSamples));
+
+        // the registers of the slot past its model are left alone
+        const std::size_t base = slot * s_regsPerSlot;
+        const std::size_t endReg = base + m_regsOfSlot[slot];
+        Register sum(0.0f);
+        for (std::size_t r = base; r < endReg; ++r) {
+            Register c = m_cos[r];
+            Register s = m_sin[r];
+            Register level = m_level[r];
+            const Register cosInc = m_cosInc[r];
+            const Register sinInc = m_sinInc[r];
+            const Register decay = m_decay[r] * masterDecay;
+            const Register panLeft = m_panLeft[r];
+            const Register panRight = m_panRight[r];
+
+            for (std::size_t done = begin; done < n; done += snapInterval) {
+                const std::size_t end = std::min(n, done + snapInterval);
+                for (std::size_t i = done; i < end; ++i) {
+                    const Register y = s * level;
+                    left[i] = Register::multiplyAdd(left[i], y, panLeft);
+                    right[i] = Register::multiplyAdd(right[i], y, panRight);
+
+                    const Register nextC = c * cosInc - s * sinInc;
+                    s = s * cosInc + c * sinInc;
+                    c = nextC;
+
+                    level *= decay;
+                }
+                level &= Register::greaterThanOrEqual(level, floor);
+            }
+
+            // same first order renorm as ModalBank
+            const Register gain =
+                Register::multiplyAdd(threeHalves, minusHalf, c * c + s * s);
+            m_cos[r] = c * gain;
+            m_sin[r] = s * gain;
+            m_level[r] = level;
+            sum += level;
+        }
+
+        // the lane levels back to their voice
+        m_amplitude[slot] = sum.sum();
+    }
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+#include "ModalModel.hpp"
+#include "NoteTable.hpp"
+#include "WorkerPool.hpp"
+
+// the modal state of every voice in one structure of arrays
+//
+// each voice owns a slot of registers sized for the largest model and uses
+// as many of them as the model of its note needs, so notes of different
+// models ring side by side and a model change stops nothing
+// slots of sounding voices are kept packed at the front of the arena and the
+// renderer walks them in order, only the registers in use, whatever voice
+// they belong to
+//
+// the master decay envelope is folded in the lanes:
+// level = velocity * amplitude / N and decay = relativeDecay * masterDecay
+// so a lane is self contained and the kernel never looks at a voice
+//
+// every lane also has its own left and right gains, a voice is panned as a
+// whole or mode by mode for the same price, see Pan.hpp
+//
+// that also makes slots independent: with a WorkerPool the slots are split
+// in jobs, every thread sums its registers in its own scratch and the
+// scratches are reduced once per chunk
+class ModalArena {
+   public:
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr std::size_t s_laneWidth = Register::size();
+    static constexpr std::size_t registersFor(std::size_t nModes)
+    {
+        return (nModes + s_laneWidth - 1) / s_laneWidth;
+    }
+
+    // allocates everything for the largest model and a scratch per thread,
+    // call this off the audio thread
+    void prepare(std::size_t nVoices, int maxBlockSize, std::size_t nThreads);
+
+    // the levels are the lane levels, velocity and 1/N included
+    // the slot takes the register count of modes, a re-triggered voice may
+    // change model
+    void start(std::size_t voice, const ModeParameters& modes);
+    void stop(std::size_t voice);
+    // the voice stays still for the first `samples` samples of the next
+    // render, for a note that starts inside the block without splitting it
+    void delay(std::size_t voice, int samples);
+    // strikes a ringing voice again, levels[j] adds to lane j at phase 0 so
+    // the output stays continuous, same levels as start
+    void strike(std::size_t voice, const std::array<float, s_maxModes>& levels);
+
+    // pitch bend: new rotation for the first nModes lanes of a voice, lane j
+    // is entry j of the ModeParameters it was started with
+    // rotationOf(j) returns something with .cos and .sin, e.g.
+    // RotationTable::lookup
+    template <typename RotationOf>
+    void retune(std::size_t voice, std::size_t nModes, RotationOf&& rotationOf)
+    {
+        jassert(voice < m_nVoices);
+        const std::size_t slot = m_slotOfVoice[voice];
+        if (slot == s_noSlot) {
+            return;
+        }
+
+        jassert(registersFor(nModes) <= m_regsOfSlot[slot]);
+
+        // a register at a time, lane by lane set() stalls on every lane
+        const std::size_t base = slot * s_regsPerSlot;
+        for (std::size_t r = 0; r < registersFor(nModes); ++r) {
+            alignas(s_cacheLine) std::array<float, s_laneWidth> cosIncs;
+            alignas(s_cacheLine) std::array<float, s_laneWidth> sinIncs;
+            m_cosInc[base + r].copyToRawArray(cosIncs.data());
+            m_sinInc[base + r].copyToRawArray(sinIncs.data());
+
+            // padding lanes keep their identity rotation
+            const std::size_t first = r * s_laneWidth;
+            const std::size_t end = std::min(nModes, first + s_laneWidth);
+            for (std::size_t j = first; j < end; ++j) {
+                const auto rotation = rotationOf(j);
+                cosIncs[j - first] = rotation.cos;
+                sinIncs[j - first] = rotation.sin;
+            }
+
+            m_cosInc[base + r] = Register::fromRawArray(cosIncs.data());
+            m_sinInc[base + r] = Register::fromRawArray(sinIncs.data());
+        }
+    }
+
+    // stereo placement: gainsOf(j) returns the Pan::Gains of lane j, same
+    // entries as retune
+    // a voice starts with gains of 1 on both channels until this is called
+    template <typename GainsOf>
+    void setPan(std::size_t voice, std::size_t nModes, GainsOf&& gainsOf)
+    {
+        jassert(voice < m_nVoices);
+        const std::size_t slot = m_slotOfVoice[voice];
+        if (slot == s_noSlot) {
+            return;
+        }
+
+        jassert(registersFor(nModes) <= m_regsOfSlot[slot]);
+
+        const std::size_t base = slot * s_regsPerSlot;
+        for (std::size_t r = 0; r < registersFor(nModes); ++r) {
+            alignas(s_cacheLine) std::array<float, s_laneWidth> lefts;
+            alignas(s_cacheLine) std::array<float, s_laneWidth> rights;
+            m_panLeft[base + r].copyToRawArray(lefts.data());
+            m_panRight[base + r].copyToRawArray(rights.data());
+
+            const std::size_t first = r * s_laneWidth;
+            const std::size_t end = std::min(nModes, first + s_laneWidth);
+            for (std::size_t j = first; j < end; ++j) {
+                const auto gains = gainsOf(j);
+                lefts[j - first] = gains.left;
+                rights[j - first] = gains.right;
+            }
+
+            m_panLeft[base + r] = Register::fromRawArray(lefts.data());
+            m_panRight[base + r] = Register::fromRawArray(rights.data());
+        }
+    }
+
+    bool isActive(std::size_t voice) const;
+
+    // sum of the lane levels of a voice as of the last render
+    // upper bound of what the voice can output
+    float amplitude(std::size_t voice) const;
+
+    // adds the mix of every active voice, the left one to the even
+    // channels and the right one to the odd ones, or both to a mono output
+    // spreads the slots over workers if given, at most as many threads as
+    // prepared for
+    // the lanes are float whatever the output, a double buffer takes the
+    // mix as it is added
+    template <typename Sample>
+    void render(juce::AudioBuffer<Sample>& outputBuffer,
+                int startSample,
+                int numSamples,
+                float masterDecay,
+                WorkerPool* workers = nullptr);
+
+   private:
+    // small enough to balance the threads, large enough that claiming a job
+    // is nothing next to rendering it
+    static constexpr std::size_t s_slotsPerJob = 8;
+
+    // chunkStart is where the chunk is in the render, for the delays
+    void renderChunk(float* left,
+                     float* right,
+                     int chunkStart,
+                     int numSamples,
+                     float masterDecay,
+                     WorkerPool* workers);
+    // the slots [firstSlot, endSlot) summed in a thread's scratch, left then
+    // right, which must be clear
+    void renderSlots(Register* scratch,
+                     std::size_t firstSlot,
+                     std::size_t endSlot,
+                     int chunkStart,
+                     int numSamples,
+                     float masterDecay);
+    void moveSlot(std::size_t from, std::size_t to);
+
+    static constexpr std::size_t s_cacheLine = 64;
+    static constexpr std::size_t s_nFields = 8;
+    // registersFor(s_maxModes), which can't be called until the class is
+    // complete
+    static constexpr std::size_t s_regsPerSlot =
+        (s_maxModes + s_laneWidth - 1) / s_laneWidth;
+
+    struct AlignedDeleter {
+        void operator()(Register* p) const
+        {
+            ::operator delete(p, std::align_val_t{s_cacheLine});
+        }
+    };
+    std::unique_ptr<Register[], AlignedDeleter> m_storage;
+
+    // views in m_storage, each one starts on its own cache line
+    Register* m_cos = nullptr;
+    Register* m_sin = nullptr;
+    Register* m_cosInc = nullptr;
+    Register* m_sinInc = nullptr;
+    Register* m_level = nullptr;
+    Register* m_decay = nullptr;  // relative, the master decay is applied
+                                  // when rendering
+    Register* m_panLeft = nullptr;
+    Register* m_panRight = nullptr;
+
+    std::size_t m_nVoices = 0;
+    std::size_t m_nActive = 0;
+
+    // voice -> packed slot and back
+    static constexpr std::size_t s_noSlot = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> m_slotOfVoice;
+    std::vector<std::size_t> m_voiceOfSlot;
+
+    std::vector<float> m_amplitude;  // per slot
+    // per slot, the registers the model of its note needs, the rest of the
+    // slot is never touched
+    std::vector<std::size_t> m_regsOfSlot;
+    // per slot, first sample of the next render, see delay
+    std::vector<int> m_begin;
+
+    // per thread, one register of partial sums per sample and per side,
+    // reduced once per chunk
+    std::vector<Register> m_scratch;
+    std::size_t m_chunkSize = 1;
+    std::size_t m_nThreads = 1;
+    std::vector<float> m_mixLeft;
+    std::vector<float> m_mixRight;
+};
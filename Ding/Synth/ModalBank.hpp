@@ -0,0 +1,515 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <juce_dsp/juce_dsp.h>
+
+#include "Denormals.hpp"
+#include "RotationTable.hpp"
+
+// N SineOscillators and their levels, stored as a structure of arrays
+//
+// each field lives in SIMD registers so every mode of a voice is rotated and
+// decayed in the same instructions (SSE/AVX/NEON, whatever SIMDRegister picks)
+//
+// modes are padded up to a whole number of registers, padding lanes are
+// silent identity rotations so they never produce anything
+//
+// unlike SineOscillator there is no renorm timer, the owner is expected to
+// call renormalize() once per rendered block
+//
+// the kernels take the number of modes of the model as a template parameter,
+// a static upper bound of the live modes that sizes their scratch arrays,
+// the loops themselves stop at the live ones
+//
+// modes are added one by one and packed at the front of the bank, cull()
+// drops the ones that have become inaudible and moves the last live mode in
+// the hole, so the kernels only ever loop over live registers
+// activeModes() tells which modes of the model are still there
+//
+// two kernels over the same state:
+// - tick() vectorizes across modes, one sample per call, tickGliding() is
+//   the same with an amplitude dependent pitch
+// - renderTimeAxis() vectorizes across time, s_laneWidth samples of one mode
+//   per instruction, for when there are too few modes to fill a register
+//
+// Sample is the precision of the phasors and of the output, double keeps
+// the phase of a long low note exact for longer at half the lanes per
+// register
+// the note parameters stay float, only the state is in Sample
+template <std::size_t NModes, typename Sample = float>
+class ModalBank {
+   public:
+    using Register = juce::dsp::SIMDRegister<Sample>;
+
+    static constexpr std::size_t s_nModes = NModes;
+    static constexpr std::size_t s_laneWidth = Register::size();
+    static constexpr std::size_t registersFor(std::size_t nModes)
+    {
+        return (nModes + s_laneWidth - 1) / s_laneWidth;
+    }
+    static constexpr std::size_t s_nRegisters = registersFor(NModes);
+
+    // one bit per mode of the model
+    using ModeMask = std::uint32_t;
+    static_assert(NModes <= 32);
+
+    ModalBank() { clear(); }
+
+    // no live mode, every lane silent
+    void clear()
+    {
+        for (std::size_t i = 0; i < NModes; ++i) {
+            silenceLane(i);
+        }
+        m_nLive = 0;
+        m_activeModes = 0;
+    }
+
+    // appends mode `mode` of the model to the live modes
+    // phaseIncrement is in radians per sample
+    // decay gets multiplied into the level at each sample
+    void addMode(std::size_t mode,
+                 float phaseIncrement,
+                 float level,
+                 float decay)
+    {
+        const auto inc = static_cast<double>(phaseIncrement);
+        addMode(mode, phaseIncrement, std::cos(inc), std::sin(inc), level,
+                decay);
+    }
+
+    // same with the rotation by the phase increment already computed, see
+    // NoteTable, no transcendental in there
+    void addMode(std::size_t mode,
+                 float phaseIncrement,
+                 double cosInc,
+                 double sinInc,
+                 float level,
+                 float decay)
+    {
+        jassert(m_nLive < NModes);
+        jassert(mode < NModes);
+
+        const std::size_t i = m_nLive++;
+        const std::size_t r = i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+        m_modeOfLane[i] = static_cast<std::uint8_t>(mode);
+        m_activeModes |= ModeMask{1} << mode;
+
+        m_cos[r].set(lane, 1.0f);
+        m_sin[r].set(lane, 0.0f);
+        m_level[r].set(lane, level);
+        m_decay[r].set(lane, decay);
+
+        setRotation(i, phaseIncrement, cosInc, sinInc);
+    }
+
+    // strikes mode `mode` of the model again on top of what it is ringing
+    // the impulse adds to the phasor of the mode at phase 0, which keeps the
+    // output continuous
+    // a mode that isn't live anymore comes back like addMode
+    void strike(std::size_t mode,
+                float phaseIncrement,
+                double cosInc,
+                double sinInc,
+                float level,
+                float decay)
+    {
+        if ((m_activeModes & (ModeMask{1} << mode)) == 0) {
+            addMode(mode, phaseIncrement, cosInc, sinInc, level, decay);
+            return;
+        }
+
+        std::size_t i = 0;
+        while (m_modeOfLane[i] != mode) {
+            ++i;
+        }
+        const std::size_t r = i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+
+        const Sample current = m_level[r].get(lane);
+        const Sample x = current * m_cos[r].get(lane) + level;
+        const Sample y = current * m_sin[r].get(lane);
+        const Sample sum = std::hypot(x, y);
+        if (sum > 0) {
+            m_cos[r].set(lane, x / sum);
+            m_sin[r].set(lane, y / sum);
+            m_level[r].set(lane, sum);
+        }
+    }
+
+    // multiplies every live level, for owners that keep an envelope outside
+    // of the lanes
+    void scaleLevels(float gain)
+    {
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            m_level[r] *= gain;
+        }
+    }
+
+    // pitch bend: new phase increment for every live mode, phase and level
+    // untouched
+    // phaseIncrementOf(mode) returns the phase increment of mode `mode` of
+    // the model, the rotation comes from RotationTable, no transcendental
+    // call it between blocks, the time axis kernel picks it up in
+    // prepareTimeAxis
+    template <typename PhaseIncrementOf>
+    void retune(PhaseIncrementOf&& phaseIncrementOf)
+    {
+        for (std::size_t i = 0; i < m_nLive; ++i) {
+            const float phaseIncrement = phaseIncrementOf(m_modeOfLane[i]);
+            const RotationTable::Rotation rotation =
+                RotationTable::lookup(phaseIncrement);
+            setRotation(i, phaseIncrement, static_cast<double>(rotation.cos),
+                        static_cast<double>(rotation.sin));
+        }
+    }
+
+    // drops every live mode whose level is below floor
+    // call it between blocks, the kernels never see a culled mode again
+    void cull(float floor)
+    {
+        std::size_t i = 0;
+        while (i < m_nLive) {
+            const std::size_t r = i / s_laneWidth;
+            const std::size_t lane = i % s_laneWidth;
+            if (m_level[r].get(lane) >= floor) {
+                ++i;
+                continue;
+            }
+
+            // the last live mode fills the hole, then gets checked in turn
+            m_activeModes &= ~(ModeMask{1} << m_modeOfLane[i]);
+            const std::size_t last = --m_nLive;
+            if (i != last) {
+                moveLane(last, i);
+            }
+            silenceLane(last);
+        }
+    }
+
+    // levels below Denormals::s_levelFloor become exactly 0
+    // tick() callers do this every Denormals::s_snapInterval samples,
+    // renderTimeAxis() takes care of it itself
+    void snapToZero()
+    {
+        const Register floor(Denormals::s_levelFloor);
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            m_level[r] &= Register::greaterThanOrEqual(m_level[r], floor);
+        }
+    }
+
+    // bit i is set while mode i of the model is rendered
+    ModeMask activeModes() const { return m_activeModes; }
+
+    std::size_t liveModes() const { return m_nLive; }
+
+    // upper bound of |tick()|
+    float amplitude() const
+    {
+        Register sum(0.0f);
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            sum += m_level[r];
+        }
+        return static_cast<float>(sum.sum());
+    }
+
+    // sum of sin * level over the live modes, then advance one sample
+    // NActive is the number of modes of the model, an upper bound of the
+    // live ones
+    template <std::size_t NActive = NModes>
+    Sample tick()
+    {
+        static_assert(NActive <= NModes);
+        jassert(m_nLive <= NActive);
+        Register acc(0.0f);
+
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            acc = Register::multiplyAdd(acc, m_sin[r], m_level[r]);
+
+            // same rotation as SineOscillator::advance, one lane per mode
+            const Register c = m_cos[r] * m_cosInc[r] - m_sin[r] * m_sinInc[r];
+            const Register s = m_sin[r] * m_cosInc[r] + m_cos[r] * m_sinInc[r];
+            m_cos[r] = c;
+            m_sin[r] = s;
+
+            m_level[r] *= m_decay[r];
+        }
+
+        return acc.sum();
+    }
+
+    // tick() with tension modulation: a mode of amplitude a runs at
+    // (1 + depth a^2) times its frequency, so it glides down as it decays
+    // the lane levels don't include the voice envelope, depth must include
+    // its square
+    //
+    // the rotation by th (1 + e) is the one by th followed by a small one by
+    // d = th e, expanded to the second order instead of a fresh sin/cos:
+    // cos(th + d) ~ cos th (1 - d^2 / 2) - d sin th
+    // sin(th + d) ~ sin th (1 - d^2 / 2) + d cos th
+    // the determinant is 1 + d^4 / 4, renormalize() takes care of it
+    template <std::size_t NActive = NModes>
+    Sample tickGliding(float depth)
+    {
+        static_assert(NActive <= NModes);
+        jassert(m_nLive <= NActive);
+        const Register one(1.0f);
+        const Register minusHalf(-0.5f);
+        Register acc(0.0f);
+
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            acc = Register::multiplyAdd(acc, m_sin[r], m_level[r]);
+
+            const Register d =
+                m_phaseInc[r] * (m_level[r] * m_level[r] * depth);
+            const Register shrink =
+                Register::multiplyAdd(one, minusHalf, d * d);
+            const Register cosInc = m_cosInc[r] * shrink - m_sinInc[r] * d;
+            const Register sinInc =
+                Register::multiplyAdd(m_sinInc[r] * shrink, m_cosInc[r], d);
+
+            const Register c = m_cos[r] * cosInc - m_sin[r] * sinInc;
+            const Register s = m_sin[r] * cosInc + m_cos[r] * sinInc;
+            m_cos[r] = c;
+            m_sin[r] = s;
+
+            m_level[r] *= m_decay[r];
+        }
+
+        return acc.sum();
+    }
+
+    // time axis kernel, call once per block before renderTimeAxis
+    //
+    // the level of mode i at sample n + j is level[n] * k^j so k^0..k^(W-1)
+    // is a constant vector for the whole block, folded with the rotation
+    // powers once here
+    template <std::size_t NActive = NModes>
+    void prepareTimeAxis(float masterDecay)
+    {
+        static_assert(NActive <= NModes);
+        for (std::size_t i = 0; i < m_nLive; ++i) {
+            const Sample k = m_decay[i / s_laneWidth].get(i % s_laneWidth) *
+                            masterDecay;
+
+            Sample power = 1;
+            for (std::size_t j = 0; j < s_laneWidth; ++j) {
+                m_decayPowers[i].set(j, power);
+                power *= k;
+            }
+            m_stepDecay[i] = power;
+
+            m_weightedCos[i] = m_decayPowers[i] * m_rotationCos[i];
+            m_weightedSin[i] = m_decayPowers[i] * m_rotationSin[i];
+        }
+    }
+
+    // writes numSamples samples to out
+    //
+    // out must be SIMD aligned and have room for numSamples rounded up to a
+    // multiple of s_laneWidth
+    //
+    // sin((n + j) th + phi) = sin(n th + phi) cos(j th) + cos(n th + phi) sin(j th)
+    // so every mode is two multiply-adds per register of output, then a
+    // scalar jump of s_laneWidth samples
+    template <std::size_t NActive = NModes>
+    void renderTimeAxis(Sample* out, int numSamples)
+    {
+        static_assert(NActive <= NModes);
+        jassert(Register::isSIMDAligned(out));
+        jassert(m_nLive <= NActive);
+
+        const std::size_t nLive = m_nLive;
+        std::array<Sample, NActive> c{};
+        std::array<Sample, NActive> s{};
+        std::array<Sample, NActive> level{};
+        for (std::size_t i = 0; i < nLive; ++i) {
+            const std::size_t r = i / s_laneWidth;
+            const std::size_t lane = i % s_laneWidth;
+            c[i] = m_cos[r].get(lane);
+            s[i] = m_sin[r].get(lane);
+            level[i] = m_level[r].get(lane);
+        }
+
+        const auto n = static_cast<std::size_t>(numSamples);
+        for (std::size_t start = 0; start < n; start += s_laneWidth) {
+            Register acc(0.0f);
+            for (std::size_t i = 0; i < nLive; ++i) {
+                acc = Register::multiplyAdd(acc, m_weightedCos[i],
+                                            Register(level[i] * s[i]));
+                acc = Register::multiplyAdd(acc, m_weightedSin[i],
+                                            Register(level[i] * c[i]));
+            }
+            acc.copyToRawArray(out + start);
+
+            // the last register may be partial, only jump over what was
+            // actually consumed
+            const std::size_t consumed = std::min(s_laneWidth, n - start);
+            for (std::size_t i = 0; i < nLive; ++i) {
+                Sample stepCos = m_stepCos[i];
+                Sample stepSin = m_stepSin[i];
+                Sample stepDecay = m_stepDecay[i];
+                if (consumed != s_laneWidth) {
+                    stepCos = m_rotationCos[i].get(consumed);
+                    stepSin = m_rotationSin[i].get(consumed);
+                    stepDecay = m_decayPowers[i].get(consumed);
+                }
+
+                const Sample nextC = c[i] * stepCos - s[i] * stepSin;
+                s[i] = s[i] * stepCos + c[i] * stepSin;
+                c[i] = nextC;
+                level[i] *= stepDecay;
+                if (level[i] < Denormals::s_levelFloor) {
+                    level[i] = 0;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < nLive; ++i) {
+            const std::size_t r = i / s_laneWidth;
+            const std::size_t lane = i % s_laneWidth;
+            m_cos[r].set(lane, c[i]);
+            m_sin[r].set(lane, s[i]);
+            m_level[r].set(lane, level[i]);
+        }
+    }
+
+    // pull every phasor back on the unit circle
+    //
+    // a block worth of float drift keeps |z|^2 within a hair of 1 so the first
+    // order expansion of 1/sqrt(x) around 1 is plenty, no sqrt, no division
+    template <std::size_t NActive = NModes>
+    void renormalize()
+    {
+        static_assert(NActive <= NModes);
+        const Register threeHalves(1.5f);
+        const Register minusHalf(-0.5f);
+
+        for (std::size_t r = 0; r < registersFor(m_nLive); ++r) {
+            const Register norm2 = m_cos[r] * m_cos[r] + m_sin[r] * m_sin[r];
+            const Register gain =
+                Register::multiplyAdd(threeHalves, minusHalf, norm2);
+            m_cos[r] *= gain;
+            m_sin[r] *= gain;
+        }
+    }
+
+   private:
+    // per sample rotation of lane i and its powers for the time axis kernel
+    void setRotation(std::size_t i,
+                     float phaseIncrement,
+                     double cosInc,
+                     double sinInc)
+    {
+        const std::size_t r = i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+        m_phaseInc[r].set(lane, static_cast<Sample>(phaseIncrement));
+        m_cosInc[r].set(lane, static_cast<Sample>(cosInc));
+        m_sinInc[r].set(lane, static_cast<Sample>(sinInc));
+
+        // rotation by j * phaseIncrement in lane j
+        // then rotation by a whole register worth of samples
+        // built in plain arrays, lane by lane set() stalls on every lane
+        alignas(64) std::array<Sample, s_laneWidth> rotationCos;
+        alignas(64) std::array<Sample, s_laneWidth> rotationSin;
+        double c = 1.0;
+        double s = 0.0;
+        for (std::size_t j = 0; j < s_laneWidth; ++j) {
+            rotationCos[j] = static_cast<Sample>(c);
+            rotationSin[j] = static_cast<Sample>(s);
+            const double nextC = c * cosInc - s * sinInc;
+            s = s * cosInc + c * sinInc;
+            c = nextC;
+        }
+        m_rotationCos[i] = Register::fromRawArray(rotationCos.data());
+        m_rotationSin[i] = Register::fromRawArray(rotationSin.data());
+        m_stepCos[i] = static_cast<Sample>(c);
+        m_stepSin[i] = static_cast<Sample>(s);
+    }
+
+    // silent identity rotation, also what padding lanes look like
+    void silenceLane(std::size_t i)
+    {
+        const std::size_t r = i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+
+        m_cos[r].set(lane, 1.0f);
+        m_sin[r].set(lane, 0.0f);
+        m_phaseInc[r].set(lane, 0.0f);
+        m_cosInc[r].set(lane, 1.0f);
+        m_sinInc[r].set(lane, 0.0f);
+        m_level[r].set(lane, 0.0f);
+        m_decay[r].set(lane, 0.0f);
+
+        m_rotationCos[i] = 1.0f;
+        m_rotationSin[i] = 0.0f;
+        m_stepCos[i] = 1.0f;
+        m_stepSin[i] = 0.0f;
+        m_decayPowers[i] = 0.0f;
+        m_weightedCos[i] = 0.0f;
+        m_weightedSin[i] = 0.0f;
+        m_stepDecay[i] = 0.0f;
+    }
+
+    void moveLane(std::size_t from, std::size_t to)
+    {
+        const std::size_t rf = from / s_laneWidth;
+        const std::size_t lf = from % s_laneWidth;
+        const std::size_t rt = to / s_laneWidth;
+        const std::size_t lt = to % s_laneWidth;
+
+        m_cos[rt].set(lt, m_cos[rf].get(lf));
+        m_sin[rt].set(lt, m_sin[rf].get(lf));
+        m_phaseInc[rt].set(lt, m_phaseInc[rf].get(lf));
+        m_cosInc[rt].set(lt, m_cosInc[rf].get(lf));
+        m_sinInc[rt].set(lt, m_sinInc[rf].get(lf));
+        m_level[rt].set(lt, m_level[rf].get(lf));
+        m_decay[rt].set(lt, m_decay[rf].get(lf));
+
+        m_rotationCos[to] = m_rotationCos[from];
+        m_rotationSin[to] = m_rotationSin[from];
+        m_stepCos[to] = m_stepCos[from];
+        m_stepSin[to] = m_stepSin[from];
+        m_decayPowers[to] = m_decayPowers[from];
+        m_weightedCos[to] = m_weightedCos[from];
+        m_weightedSin[to] = m_weightedSin[from];
+        m_stepDecay[to] = m_stepDecay[from];
+
+        m_modeOfLane[to] = m_modeOfLane[from];
+    }
+
+    // live modes are the first m_nLive lanes
+    std::size_t m_nLive = 0;
+    ModeMask m_activeModes = 0;
+    std::array<std::uint8_t, NModes> m_modeOfLane{};
+
+    std::array<Register, s_nRegisters> m_cos;
+    std::array<Register, s_nRegisters> m_sin;
+
+    std::array<Register, s_nRegisters> m_cosInc;
+    std::array<Register, s_nRegisters> m_sinInc;
+    // radians per sample, only tickGliding needs it
+    std::array<Register, s_nRegisters> m_phaseInc;
+
+    std::array<Register, s_nRegisters> m_level;
+    std::array<Register, s_nRegisters> m_decay;
+
+    // time axis kernel, one entry per live mode, lanes are consecutive
+    // samples of that mode
+    std::array<Register, NModes> m_rotationCos;
+    std::array<Register, NModes> m_rotationSin;
+    std::array<Sample, NModes> m_stepCos{};
+    std::array<Sample, NModes> m_stepSin{};
+
+    // rebuilt by prepareTimeAxis, they depend on the master decay
+    std::array<Register, NModes> m_decayPowers;
+    std::array<Register, NModes> m_weightedCos;
+    std::array<Register, NModes> m_weightedSin;
+    std::array<Sample, NModes> m_stepDecay{};
+};
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+// an instrument is a compile time modal model:
+//
+// struct Model {
+//     static constexpr std::size_t nModes;
+//     static constexpr std::array<float, nModes> frequencyRatios;
+//     static constexpr std::array<float, nModes> relativeDecays;
+//     static constexpr std::array<float, nModes> initialAmplitude;
+// };
+//
+// voices are rendered by kernels templated on the model so its tables and
+// constants are folded in, the bank loops only go over the modes still
+// live, see ModalBank, the model is picked at runtime once per block, see
+// dispatchModel
+//
+// the glockenspiel ratios are those of the flexural modes of a free-free
+// Euler-Bernoulli beam, i.e. (k_n L / k_1 L)^2, see aux/inharmonicity.py
+// relative decays are per sample factors on top of the master decay, never
+// above 1, the tail goes by the master decay alone
+
+struct GlockenspielModel {
+    static constexpr std::size_t nModes = 6;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        2.7565361290810895f,
+        5.403921459425173f,
+        8.932951281230347f,
+        13.34429142562536f,
+        18.820878932628247f,
+    };
+
+    // gets multiplied at each sample so these parameters act pretty
+    // aggressively
+    // the simply supported beams at 22.4% select the first and fifth partials
+    //
+    // in a perfect world, the first and fifth partials ring out forever but
+    // they actually lose energy to acoustic radiation (i.e. we hear them)
+    //
+    // these should probably be physics based instead of randomly tuned
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.95f, 0.9f, 0.7f, 1.0f, 0.5f,
+    };
+
+    // depends on the strike position
+    // not implemented yet so 1.0f for everyone
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    };
+};
+
+// for heavy sessions: the fourth and sixth modes are gone within a few
+// samples anyways, keep the ones that actually ring
+struct GlockenspielLiteModel {
+    static constexpr std::size_t nModes = 4;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        2.7565361290810895f,
+        5.403921459425173f,
+        13.34429142562536f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.95f, 0.9f, 1.0f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 1.0f, 1.0f, 1.0f,
+    };
+};
+
+// the glockenspiel plus the next six beam modes, k_n L ~ (2n + 1) pi / 2
+// they only fit under the hard cut for the lower notes
+struct GlockenspielHiFiModel {
+    static constexpr std::size_t nModes = 12;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        2.7565361290810895f,
+        5.403921459425173f,
+        8.932951281230347f,
+        13.34429142562536f,
+        18.820878932628247f,
+        24.8137638836861f,
+        31.87190116615682f,
+        39.81230560893636f,
+        48.63497721202477f,
+        58.33991597542199f,
+        68.92712189912808f,
+    };
+
+    // the higher the mode, the harder it is to keep ringing
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.95f, 0.9f, 0.7f, 1.0f, 0.5f,
+        0.8f, 0.7f,  0.6f, 0.5f, 0.4f, 0.3f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+        1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    };
+};
+
+// the other instruments of the bank, the programs of the plugin
+//
+// the factors closer to 1 than the glockenspiel's are decays of a few tens
+// of ms to a few seconds at 48kHz, 0.999 is ~60dB in 150ms
+
+// steel plates over wooden boxes tuned to the fundamental, struck by felt
+// hammers: mostly fundamental, the beam modes above are soft and short
+struct CelestaModel {
+    static constexpr std::size_t nModes = 4;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        2.7565361290810895f,
+        5.403921459425173f,
+        8.932951281230347f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.999f, 0.998f, 0.995f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 0.25f, 0.1f, 0.04f,
+    };
+};
+
+// aluminium bars, the arch cut under the bar tunes the second mode two
+// octaves up and the third three octaves and a major third up
+// barely damped, the upper modes ring almost as long as the fundamental
+struct VibraphoneModel {
+    static constexpr std::size_t nModes = 3;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        4.0f,
+        10.0f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.9997f, 0.999f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 0.3f, 0.12f,
+    };
+};
+
+// rosewood bars undercut the same way, 1:4:10, with a tube under each bar
+// that only resonates with the fundamental
+// the wood eats the upper modes within a few hundred ms
+struct MarimbaModel {
+    static constexpr std::size_t nModes = 3;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        4.0f,
+        10.0f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.9975f, 0.99f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 0.35f, 0.08f,
+    };
+};
+
+// a tube rings with the beam modes too, but the pitch we hear is the strike
+// tone an octave below the fourth mode, where the fourth, fifth and sixth
+// modes sit at ~2:3:4 of a missing fundamental
+// the ratios are the beam's from the second mode on, over half the fourth,
+// the first one is too low and too soft to matter
+struct TubularBellModel {
+    static constexpr std::size_t nModes = 7;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        0.617161f, 1.209885f, 2.0f, 2.987656f, 4.21381f, 5.555558f, 7.135805f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        0.99995f, 0.99998f, 1.0f, 0.99995f, 0.9999f, 0.9997f, 0.9994f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        0.25f, 0.5f, 1.0f, 0.9f, 0.7f, 0.4f, 0.25f,
+    };
+};
+
+// small thick bronze discs: the (n, 0) modes of a free disc, n = 2 to 6,
+// struck at the rim and ringing for seconds
+struct CrotalesModel {
+    static constexpr std::size_t nModes = 5;
+
+    static constexpr std::array<float, nModes> frequencyRatios = {
+        1.0f,
+        2.328f,
+        4.112f,
+        6.3f,
+        8.83f,
+    };
+
+    static constexpr std::array<float, nModes> relativeDecays = {
+        1.0f, 0.9999f, 0.9998f, 0.9995f, 0.999f,
+    };
+
+    static constexpr std::array<float, nModes> initialAmplitude = {
+        1.0f, 0.6f, 0.45f, 0.3f, 0.2f,
+    };
+};
+
+// runtime handle on the models, same order as the Model parameter
+// new models go at the end, saved sessions store the index
+enum class ModelId {
+    lite,
+    glockenspiel,
+    hiFi,
+    celesta,
+    vibraphone,
+    marimba,
+    tubularBell,
+    crotales,
+};
+
+static constexpr std::size_t s_nModels = 8;
+
+// every buffer that holds modes is sized for the largest model
+static constexpr std::size_t s_maxModes = std::max({
+    GlockenspielLiteModel::nModes,
+    GlockenspielModel::nModes,
+    GlockenspielHiFiModel::nModes,
+    CelestaModel::nModes,
+    VibraphoneModel::nModes,
+    MarimbaModel::nModes,
+    TubularBellModel::nModes,
+    CrotalesModel::nModes,
+});
+
+// calls f(Model{}) with the model type matching id
+// this is the one runtime branch, everything below it is specialized
+template <typename F>
+decltype(auto) dispatchModel(const ModelId id, F&& f)
+{
+    switch (id) {
+        case ModelId::lite:
+            return f(GlockenspielLiteModel{});
+        case ModelId::hiFi:
+            return f(GlockenspielHiFiModel{});
+        case ModelId::celesta:
+            return f(CelestaModel{});
+        case ModelId::vibraphone:
+            return f(VibraphoneModel{});
+        case ModelId::marimba:
+            return f(MarimbaModel{});
+        case ModelId::tubularBell:
+            return f(TubularBellModel{});
+        case ModelId::crotales:
+            return f(CrotalesModel{});
+        case ModelId::glockenspiel:
+        default:
+            return f(GlockenspielModel{});
+    }
+}
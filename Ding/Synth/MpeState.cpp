@@ -0,0 +1,66 @@
+#include "MpeState.hpp"
+
+namespace {
+namespace impl {
+static constexpr int timbreController = 74;
+
+static constexpr float pitchWheelCentre = 8192.0f;
+static constexpr float inv127 = 1.0f / 127.0f;
+}  // namespace impl
+}  // namespace
+
+void MpeState::processMidi(const juce::MidiMessage& message)
+{
+    // zone layout changes come as RPNs
+    m_zones.processNextMidiEvent(message);
+
+    const int channel = message.getChannel();
+    if (channel < 1) {
+        return;
+    }
+
+    if (message.isPitchWheel()) {
+        const float position =
+            (static_cast<float>(message.getPitchWheelValue()) -
+             impl::pitchWheelCentre) /
+            impl::pitchWheelCentre;
+        m_bend[index(channel)] = position * bendRange(channel);
+    } else if (message.isChannelPressure()) {
+        m_pressure[index(channel)] =
+            static_cast<float>(message.getChannelPressureValue()) *
+            impl::inv127;
+    } else if (message.isControllerOfType(impl::timbreController)) {
+        m_timbre[index(channel)] =
+            static_cast<float>(message.getControllerValue()) * impl::inv127;
+    }
+}
+
+float MpeState::bend(const int channel) const
+{
+    float semitones = m_bend[index(channel)];
+
+    for (const auto& zone : {m_zones.getLowerZone(), m_zones.getUpperZone()}) {
+        if (zone.isActive() && zone.isUsingChannelAsMemberChannel(channel)) {
+            semitones += m_bend[index(zone.getMasterChannel())];
+        }
+    }
+
+    return semitones;
+}
+
+float MpeState::bendRange(const int channel) const
+{
+    for (const auto& zone : {m_zones.getLowerZone(), m_zones.getUpperZone()}) {
+        if (!zone.isActive()) {
+            continue;
+        }
+        if (channel == zone.getMasterChannel()) {
+            return static_cast<float>(zone.masterPitchbendRange);
+        }
+        if (zone.isUsingChannelAsMemberChannel(channel)) {
+            return static_cast<float>(zone.perNotePitchbendRange);
+        }
+    }
+
+    return s_defaultBendRange;
+}
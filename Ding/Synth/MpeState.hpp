@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+// per channel expression, MPE or not
+//
+// with an MPE zone (set by the controller's MCM) every note has a member
+// channel of its own: its pitch bend, pressure and timbre (CC74) are per
+// note, the master channel bends the whole zone
+// without one, channels behave like plain MIDI channels
+//
+// the synth feeds every MIDI message in, voices poll their channel once per
+// rendered block, so expression is control rate and costs nothing while it
+// doesn't move
+class MpeState {
+   public:
+    // bend range of a plain channel, in semitones
+    static constexpr float s_defaultBendRange = 2.0f;
+
+    void processMidi(const juce::MidiMessage& message);
+
+    // semitones, zone master bend included
+    float bend(int channel) const;
+    // [0, 1]
+    float pressure(int channel) const { return m_pressure[index(channel)]; }
+    // [0, 1], 0.5 at rest
+    float timbre(int channel) const { return m_timbre[index(channel)]; }
+
+   private:
+    static std::size_t index(int channel)
+    {
+        jassert(channel >= 1 && channel <= 16);
+        return static_cast<std::size_t>(channel);
+    }
+
+    float bendRange(int channel) const;
+
+    juce::MPEZoneLayout m_zones;
+
+    // indexed by midi channel, 0 is unused
+    std::array<float, 17> m_bend{};
+    std::array<float, 17> m_pressure{};
+    std::array<float, 17> m_timbre = [] {
+        std::array<float, 17> rest{};
+        rest.fill(0.5f);
+        return rest;
+    }();
+};
@@ -0,0 +1,96 @@
+#include "NoteTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+namespace {
+namespace impl {
+// glockenspiels play pretty high
+// hard cut LPF: do not render stuff that will alias
+// soft knee LPF: HF modes are hard to excite and decay very fast
+static constexpr double hfHardCut = 18.0 * 1000.0;
+static constexpr double hfSoftKnee = 10.0 * 1000.0;
+
+// modes this close to nyquist are not rendered either, whatever the hard cut
+// says, e.g. at 32kHz
+static constexpr double nyquistMargin = 0.45;
+
+// exponential rolloff + hard cut
+double hfAttenuation(double freq)
+{
+    if (freq >= hfHardCut) {
+        return 0.0;
+    } else if (freq >= hfSoftKnee) {
+        // scale [softKnee, hardCut] to [0, 1]
+        const double t = (freq - hfSoftKnee) / (hfHardCut - hfSoftKnee);
+        return std::exp(-3.0 * t);  // e^(-3) ≈ 0.05 at hardCut
+    } else {
+        return 1.0;
+    }
+}
+}  // namespace impl
+}  // namespace
+
+void NoteTable::prepare(const double sampleRate)
+{
+    m_notes.resize(s_nModels * s_nNotes);
+
+    build<GlockenspielLiteModel>(ModelId::lite, sampleRate);
+    build<GlockenspielModel>(ModelId::glockenspiel, sampleRate);
+    build<GlockenspielHiFiModel>(ModelId::hiFi, sampleRate);
+    build<CelestaModel>(ModelId::celesta, sampleRate);
+    build<VibraphoneModel>(ModelId::vibraphone, sampleRate);
+    build<MarimbaModel>(ModelId::marimba, sampleRate);
+    build<TubularBellModel>(ModelId::tubularBell, sampleRate);
+    build<CrotalesModel>(ModelId::crotales, sampleRate);
+}
+
+const ModeParameters& NoteTable::get(const ModelId model,
+                                     const int midiNote) const
+{
+    jassert(!m_notes.empty());
+    jassert(midiNote >= 0 && midiNote < s_nNotes);
+
+    return m_notes[static_cast<std::size_t>(model) * s_nNotes +
+                   static_cast<std::size_t>(midiNote)];
+}
+
+template <typename Model>
+void NoteTable::build(const ModelId model, const double sampleRate)
+{
+    // modes that would be cut anyways are not even started
+    const double cutoff =
+        std::min(impl::hfHardCut, impl::nyquistMargin * sampleRate);
+
+    for (int note = 0; note < s_nNotes; ++note) {
+        ModeParameters& modes = m_notes[static_cast<std::size_t>(model) *
+                                            s_nNotes +
+                                        static_cast<std::size_t>(note)];
+        modes = {};
+
+        const double fundamental =
+            juce::MidiMessage::getMidiNoteInHertz(note);
+
+        for (std::size_t i = 0; i < Model::nModes; i++) {
+            const double freq = fundamental * Model::frequencyRatios[i];
+            if (freq >= cutoff) {
+                continue;
+            }
+
+            const double phaseIncrement =
+                juce::MathConstants<double>::twoPi * freq / sampleRate;
+
+            const std::size_t j = modes.nModes++;
+            modes.modeIndices[j] = static_cast<std::uint8_t>(i);
+            modes.cosIncs[j] = std::cos(phaseIncrement);
+            modes.sinIncs[j] = std::sin(phaseIncrement);
+            modes.phaseIncrements[j] = static_cast<float>(phaseIncrement);
+            // soft knee around 10kHz to attenuate the 10k-20k octave
+            modes.levels[j] = Model::initialAmplitude[i] *
+                              static_cast<float>(impl::hfAttenuation(freq));
+            modes.relativeDecays[j] = Model::relativeDecays[i];
+        }
+    }
+}
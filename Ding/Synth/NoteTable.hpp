@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ModalModel.hpp"
+
+// the modes a note starts with, audible ones only
+// only the first nModes entries are used, entry j is mode modeIndices[j] of
+// the model
+struct ModeParameters {
+    std::size_t nModes;
+    std::array<std::uint8_t, s_maxModes> modeIndices;
+    // rotation by the phase increment, double so the time axis kernel can
+    // build its rotation powers from them
+    std::array<double, s_maxModes> cosIncs;
+    std::array<double, s_maxModes> sinIncs;
+    // radians per sample, what pitch bend scales
+    std::array<float, s_maxModes> phaseIncrements;
+    // hf attenuation included, velocity and 1/N not
+    std::array<float, s_maxModes> levels;
+    // per sample, relative to the master decay
+    std::array<float, s_maxModes> relativeDecays;
+};
+
+// note on coefficients of every model for every midi note
+//
+// they only depend on the sample rate, so they are computed once in prepare
+// and note on is a copy out of here, no transcendental on the audio thread
+class NoteTable {
+   public:
+    static constexpr int s_nNotes = 128;
+
+    // allocates and fills everything, call this off the audio thread
+    void prepare(double sampleRate);
+
+    const ModeParameters& get(ModelId model, int midiNote) const;
+
+   private:
+    template <typename Model>
+    void build(ModelId model, double sampleRate);
+
+    // [model][note]
+    std::vector<ModeParameters> m_notes;
+};
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+// how a SineOscillator moves its phasor around, picked at compile time
+//
+// a policy owns the phasor state and provides
+//     void setIncrement(double phaseIncrement);  // radians per sample
+//     void reset();                              // phase back to 0
+//     float sin() const;
+//     void advance();
+//
+// they trade speed against frequency and amplitude drift, DingBench's
+// oscillator bench measures both for each of them
+namespace OscillatorPolicy {
+
+// float rotation matrix, renormed with a hypot and two divisions every
+// s_renormThreshold samples
+//
+// float rounding errors lead the phasor to eventually leave the unit circle
+// so a renorm from time to time is needed
+struct Rotation {
+    // vector [x y]
+    float m_cosv = 1.0f;
+    float m_sinv = 0.0f;
+
+    // rotation matrix coefficients
+    // cos th; -sin th
+    // sin th;  cos th
+    //
+    // default value is I_2
+    float m_sinInc = 0.0f;
+    float m_cosInc = 1.0f;
+
+    std::size_t m_renormTimer = 0;
+    static constexpr std::size_t s_renormThreshold = 256;  // renorm every _
+                                                           // samples
+
+    void setIncrement(double phaseIncrement)
+    {
+        m_cosInc = static_cast<float>(std::cos(phaseIncrement));
+        m_sinInc = static_cast<float>(std::sin(phaseIncrement));
+    }
+
+    void reset()
+    {
+        m_sinv = 0.0f;
+        m_cosv = 1.0f;
+        m_renormTimer = 0;
+    }
+
+    float sin() const { return m_sinv; }
+
+    float cos() const { return m_cosv; }
+
+    void advance()
+    {
+        // matrix multiplication
+        // c[n+1] = m_cosInc; -m_sinInc  x  c[n]
+        // s[n+1]   m_sinInc;  m_cosInc     s[n]
+        const float c = m_cosv * m_cosInc - m_sinv * m_sinInc;
+        const float s = m_sinv * m_cosInc + m_cosv * m_sinInc;
+
+        m_cosv = c;
+        m_sinv = s;
+
+        m_renormTimer++;
+        if (m_renormTimer >= s_renormThreshold) {
+            const float norm = std::hypot(m_sinv, m_cosv);
+            m_sinv /= norm;
+            m_cosv /= norm;
+            m_renormTimer = 0;
+        }
+    }
+};
+
+// same rotation, the renorm is the first order expansion of 1/sqrt(x) around
+// 1: no sqrt, no division
+// drift over s_renormThreshold samples keeps |z|^2 close enough to 1 for the
+// second order term not to matter
+struct FirstOrderRenorm : Rotation {
+    void advance()
+    {
+        const float c = m_cosv * m_cosInc - m_sinv * m_sinInc;
+        const float s = m_sinv * m_cosInc + m_cosv * m_sinInc;
+
+        m_cosv = c;
+        m_sinv = s;
+
+        m_renormTimer++;
+        if (m_renormTimer >= s_renormThreshold) {
+            const float gain = 1.5f - 0.5f * (c * c + s * s);
+            m_sinv *= gain;
+            m_cosv *= gain;
+            m_renormTimer = 0;
+        }
+    }
+};
+
+// Gordon-Smith oscillator, aka the magic circle
+// x[n+1] = x[n] - e y[n]
+// y[n+1] = y[n] + e x[n+1]
+// with e = 2 sin(th / 2)
+//
+// two shears, each has a determinant of exactly 1 whatever e rounds to, so
+// the orbit is a closed ellipse and never needs a renorm
+// x and y are not in quadrature, only y is a clean sine: starting from
+// x = cos(th / 2) puts its peak at exactly 1
+struct MagicCircle {
+    float m_x = 1.0f;
+    float m_y = 0.0f;
+
+    float m_epsilon = 0.0f;
+    float m_x0 = 1.0f;
+
+    void setIncrement(double phaseIncrement)
+    {
+        m_epsilon = static_cast<float>(2.0 * std::sin(0.5 * phaseIncrement));
+        m_x0 = static_cast<float>(std::cos(0.5 * phaseIncrement));
+    }
+
+    void reset()
+    {
+        m_x = m_x0;
+        m_y = 0.0f;
+    }
+
+    float sin() const { return m_y; }
+
+    void advance()
+    {
+        m_x -= m_epsilon * m_y;
+        m_y += m_epsilon * m_x;
+    }
+};
+
+// the Rotation phasor in double
+//
+// for very long, very low notes: the increment itself is 1e-16 accurate and
+// drift between two renorms is negligible
+struct DoublePrecision {
+    double m_cosv = 1.0;
+    double m_sinv = 0.0;
+
+    double m_sinInc = 0.0;
+    double m_cosInc = 1.0;
+
+    std::size_t m_renormTimer = 0;
+    static constexpr std::size_t s_renormThreshold = 4096;
+
+    void setIncrement(double phaseIncrement)
+    {
+        m_cosInc = std::cos(phaseIncrement);
+        m_sinInc = std::sin(phaseIncrement);
+    }
+
+    void reset()
+    {
+        m_sinv = 0.0;
+        m_cosv = 1.0;
+        m_renormTimer = 0;
+    }
+
+    float sin() const { return static_cast<float>(m_sinv); }
+
+    float cos() const { return static_cast<float>(m_cosv); }
+
+    void advance()
+    {
+        const double c = m_cosv * m_cosInc - m_sinv * m_sinInc;
+        const double s = m_sinv * m_cosInc + m_cosv * m_sinInc;
+
+        m_cosv = c;
+        m_sinv = s;
+
+        m_renormTimer++;
+        if (m_renormTimer >= s_renormThreshold) {
+            const double gain = 1.5 - 0.5 * (c * c + s * s);
+            m_sinv *= gain;
+            m_cosv *= gain;
+            m_renormTimer = 0;
+        }
+    }
+};
+
+}  // namespace OscillatorPolicy
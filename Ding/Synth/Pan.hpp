@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "core/Lookups.hpp"
+
+// stereo placement of the notes
+//
+// from the player's seat the low bars are on the left, a note sits where its
+// bar is on the instrument, scaled by the stereo width
+// decorrelated modes spread either side of their bar, the way the modes of
+// a real bar don't radiate from the same spot
+//
+// the pan is constant power with a sqrt(2) gain on top, a centred note is as
+// loud on each channel as the mono voice used to be
+namespace Pan {
+
+static constexpr float s_defaultWidth = 0.7f;
+
+// the notes spread over the stereo field, past these they sit at the ends
+static constexpr int s_lowNote = 48;
+static constexpr int s_highNote = 96;
+
+// how far either side of its bar a decorrelated mode sits, 1 is a whole
+// side of the field
+static constexpr float s_modeSpread = 0.35f;
+
+struct Gains {
+    float left;
+    float right;
+};
+
+// -1 the low end, 1 the high end, before the width
+inline float barPosition(const int midiNote)
+{
+    const float x = static_cast<float>(midiNote - s_lowNote) /
+                    static_cast<float>(s_highNote - s_lowNote);
+    return std::clamp(2.0f * x - 1.0f, -1.0f, 1.0f);
+}
+
+// the fundamental stays on the bar, the other modes alternate sides
+inline float modePosition(const float barPosition, const std::size_t mode)
+{
+    if (mode == 0) {
+        return barPosition;
+    }
+    const float side = mode % 2 == 1 ? s_modeSpread : -s_modeSpread;
+    return std::clamp(barPosition + side, -1.0f, 1.0f);
+}
+
+// sqrt(2) {cos, sin}((position + 1) pi / 4), two lookups in the same table
+// since sin((p + 1) pi / 4) = cos((-p + 1) pi / 4)
+// no transcendental, a decorrelated note-on calls it once per mode
+inline Gains gains(const float position)
+{
+    return {Lookups::PanGain::evaluate(position),
+            Lookups::PanGain::evaluate(-position)};
+}
+
+}  // namespace Pan
@@ -0,0 +1,17 @@
+#pragma once
+
+// how the voices get rendered, the state of ringing notes doesn't carry over
+// from one engine to another
+enum class RenderEngine {
+    // every voice renders itself, vectorized across its modes
+    perVoice,
+    // one kernel over the modes of every voice, see ModalArena
+    arena,
+    // every voice renders itself, vectorized across time
+    timeAxis,
+    // every voice renders itself through DampedModeOscillators
+    damped,
+    // every voice is a ResonatorBank, struck by notes and excited by the
+    // sidechain input
+    resonator,
+};
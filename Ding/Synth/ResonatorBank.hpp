@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <juce_dsp/juce_dsp.h>
+
+#include "Denormals.hpp"
+
+// N two-pole resonators driven by an excitation signal
+//
+// every mode is the complex one-pole z[n] = k e^(i th) z[n-1] + g x[n], i.e. a
+// DampedModeOscillator with an input, and the output is Im(z)
+// this coupled form has the same poles as the direct form biquad
+// y[n] = 2k cos th y[n-1] - k^2 y[n-2] + ... but behaves much better for poles
+// this close to the unit circle
+//
+// a strike is an impulse so it adds to whatever is ringing: re-striking a bar
+// accumulates energy and keeps the phase continuous
+//
+// same register layout as ModalBank, one lane per mode, and the same
+// NActive template parameter on the kernels
+// modes are never culled, a silent mode can be excited again, but the kernels
+// stop at the last mode set since clear()
+template <std::size_t NModes>
+class ResonatorBank {
+   public:
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr std::size_t s_nModes = NModes;
+    static constexpr std::size_t s_laneWidth = Register::size();
+    static constexpr std::size_t registersFor(std::size_t nModes)
+    {
+        return (nModes + s_laneWidth - 1) / s_laneWidth;
+    }
+    static constexpr std::size_t s_nRegisters = registersFor(NModes);
+
+    ResonatorBank() { clear(); }
+
+    // no energy left anywhere, every mode detuned to silence
+    void clear()
+    {
+        for (std::size_t r = 0; r < s_nRegisters; ++r) {
+            m_cos[r] = 0.0f;
+            m_sin[r] = 0.0f;
+            m_cosInc[r] = 1.0f;
+            m_sinInc[r] = 0.0f;
+            m_decay[r] = 0.0f;
+            m_inputLevel[r] = 0.0f;
+            m_dampedCosInc[r] = 0.0f;
+            m_dampedSinInc[r] = 0.0f;
+            m_inputGain[r] = 0.0f;
+        }
+        m_nModes = 0;
+    }
+
+    // phaseIncrement is in radians per sample
+    // decay is the per sample decay relative to the master decay
+    // inputLevel is the peak gain of the mode for an excitation at its
+    // resonant frequency
+    //
+    // keeps the energy of the mode, retuning a ringing mode is fine
+    void setMode(std::size_t i,
+                 float phaseIncrement,
+                 float decay,
+                 float inputLevel)
+    {
+        setMode(i, std::cos(phaseIncrement), std::sin(phaseIncrement), decay,
+                inputLevel);
+    }
+
+    // same with the rotation by the phase increment already computed
+    void setMode(std::size_t i,
+                 float cosInc,
+                 float sinInc,
+                 float decay,
+                 float inputLevel)
+    {
+        const std::size_t r = i / s_laneWidth;
+        const std::size_t lane = i % s_laneWidth;
+        m_nModes = std::max(m_nModes, i + 1);
+
+        m_cosInc[r].set(lane, cosInc);
+        m_sinInc[r].set(lane, sinInc);
+        m_decay[r].set(lane, decay);
+        m_inputLevel[r].set(lane, inputLevel);
+    }
+
+    // pitch bend: new rotation for modes 0..m_nModes-1, energy untouched
+    // rotationOf(i) returns the rotation of mode i as something with .cos
+    // and .sin, e.g. RotationTable::lookup
+    // prepare picks it up
+    template <typename RotationOf>
+    void retune(RotationOf&& rotationOf)
+    {
+        // a register at a time, lane by lane set() stalls on every lane
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            alignas(64) std::array<float, s_laneWidth> cosIncs;
+            alignas(64) std::array<float, s_laneWidth> sinIncs;
+            m_cosInc[r].copyToRawArray(cosIncs.data());
+            m_sinInc[r].copyToRawArray(sinIncs.data());
+
+            const std::size_t first = r * s_laneWidth;
+            const std::size_t end = std::min(m_nModes, first + s_laneWidth);
+            for (std::size_t i = first; i < end; ++i) {
+                const auto rotation = rotationOf(i);
+                cosIncs[i - first] = rotation.cos;
+                sinIncs[i - first] = rotation.sin;
+            }
+
+            m_cosInc[r] = Register::fromRawArray(cosIncs.data());
+            m_sinInc[r] = Register::fromRawArray(sinIncs.data());
+        }
+    }
+
+    // call once per block before ticking, the master decay may have moved
+    template <std::size_t NActive = NModes>
+    void prepare(float masterDecay)
+    {
+        static_assert(NActive <= NModes);
+        jassert(m_nModes <= NActive);
+        const Register one(1.0f);
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            const Register k = m_decay[r] * masterDecay;
+            m_dampedCosInc[r] = m_cosInc[r] * k;
+            m_dampedSinInc[r] = m_sinInc[r] * k;
+            // the resonant gain of the one-pole is 1 / (1 - k)
+            m_inputGain[r] = m_inputLevel[r] * (one - k);
+        }
+    }
+
+    // impulse of the given height on every mode, on top of the current state
+    void strike(const std::array<float, NModes>& levels)
+    {
+        for (std::size_t i = 0; i < NModes; ++i) {
+            const std::size_t r = i / s_laneWidth;
+            const std::size_t lane = i % s_laneWidth;
+            m_cos[r].set(lane, m_cos[r].get(lane) + levels[i]);
+        }
+    }
+
+    // free ringing, no excitation
+    template <std::size_t NActive = NModes>
+    float tick()
+    {
+        static_assert(NActive <= NModes);
+        Register acc(0.0f);
+
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            acc += m_sin[r];
+
+            const Register c =
+                m_cos[r] * m_dampedCosInc[r] - m_sin[r] * m_dampedSinInc[r];
+            const Register s =
+                m_sin[r] * m_dampedCosInc[r] + m_cos[r] * m_dampedSinInc[r];
+            m_cos[r] = c;
+            m_sin[r] = s;
+        }
+
+        return acc.sum();
+    }
+
+    // same as tick() with one sample of excitation fed to every mode
+    template <std::size_t NActive = NModes>
+    float tick(float input)
+    {
+        static_assert(NActive <= NModes);
+        Register acc(0.0f);
+        const Register x(input);
+
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            acc += m_sin[r];
+
+            const Register c = Register::multiplyAdd(
+                m_cos[r] * m_dampedCosInc[r] - m_sin[r] * m_dampedSinInc[r],
+                m_inputGain[r], x);
+            const Register s =
+                m_sin[r] * m_dampedCosInc[r] + m_cos[r] * m_dampedSinInc[r];
+            m_cos[r] = c;
+            m_sin[r] = s;
+        }
+
+        return acc.sum();
+    }
+
+    // modes with |Re z| + |Im z| below Denormals::s_levelFloor become exactly
+    // 0, call it every Denormals::s_snapInterval samples
+    // a steady excitation keeps its modes well above the floor
+    void snapToZero()
+    {
+        const Register floor(Denormals::s_levelFloor);
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            const auto audible = Register::greaterThanOrEqual(
+                Register::abs(m_cos[r]) + Register::abs(m_sin[r]), floor);
+            m_cos[r] &= audible;
+            m_sin[r] &= audible;
+        }
+    }
+
+    // upper bound of |tick()|, sum of |Re z| + |Im z| over every mode
+    float amplitude() const
+    {
+        Register sum(0.0f);
+        for (std::size_t r = 0; r < registersFor(m_nModes); ++r) {
+            sum += Register::abs(m_cos[r]) + Register::abs(m_sin[r]);
+        }
+        return sum.sum();
+    }
+
+   private:
+    std::size_t m_nModes = 0;
+
+    // z = cos + i sin, its magnitude is the level of the mode
+    std::array<Register, s_nRegisters> m_cos;
+    std::array<Register, s_nRegisters> m_sin;
+
+    // unit rotation, relative decay and input level, set on note on
+    std::array<Register, s_nRegisters> m_cosInc;
+    std::array<Register, s_nRegisters> m_sinInc;
+    std::array<Register, s_nRegisters> m_decay;
+    std::array<Register, s_nRegisters> m_inputLevel;
+
+    // rebuilt by prepare
+    std::array<Register, s_nRegisters> m_dampedCosInc;
+    std::array<Register, s_nRegisters> m_dampedSinInc;
+    std::array<Register, s_nRegisters> m_inputGain;
+};
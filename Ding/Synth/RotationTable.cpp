@@ -0,0 +1,42 @@
+#include "RotationTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+namespace impl {
+// f over [0, pi], N entries, both ends included
+template <std::size_t N, typename F>
+std::array<float, N> tabulate(F&& f)
+{
+    std::array<float, N> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        const double phase = 3.14159265358979323846 * static_cast<double>(i) /
+                             static_cast<double>(N - 1);
+        table[i] = static_cast<float>(f(phase));
+    }
+    return table;
+}
+}  // namespace impl
+}  // namespace
+
+// built once at load time, never on the audio thread
+const RotationTable::Table RotationTable::s_cos =
+    impl::tabulate<s_size + 1>([](double x) { return std::cos(x); });
+const RotationTable::Table RotationTable::s_sin =
+    impl::tabulate<s_size + 1>([](double x) { return std::sin(x); });
+
+RotationTable::Rotation RotationTable::lookup(const float phaseIncrement)
+{
+    const float x =
+        std::clamp(phaseIncrement, 0.0f, s_maxIncrement) * s_invStep;
+
+    // x == s_size lands on the guard entry
+    const auto i = std::min(static_cast<std::size_t>(x), s_size - 1);
+    const float frac = x - static_cast<float>(i);
+
+    return {
+        s_cos[i] + frac * (s_cos[i + 1] - s_cos[i]),
+        s_sin[i] + frac * (s_sin[i + 1] - s_sin[i]),
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// cos and sin of a phase increment without a transcendental, for retuning
+// ringing modes at control rate
+//
+// linear interpolation over [0, pi], the error is ~(pi / s_size)^2 / 8, i.e.
+// the float epsilon: the rotation is as good as a fresh std::cos/std::sin
+// and the renorms take care of the magnitude
+class RotationTable {
+   public:
+    struct Rotation {
+        float cos;
+        float sin;
+    };
+
+    // phaseIncrement is in radians per sample, clamped to [0, pi]
+    static Rotation lookup(float phaseIncrement);
+
+   private:
+    static constexpr std::size_t s_size = 4096;
+    static constexpr float s_maxIncrement = 3.14159265358979323846f;
+    static constexpr float s_invStep =
+        static_cast<float>(s_size) / s_maxIncrement;
+
+    // one guard entry at pi so interpolation never reads past the end
+    using Table = std::array<float, s_size + 1>;
+    static const Table s_cos;
+    static const Table s_sin;
+};
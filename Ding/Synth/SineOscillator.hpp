@@ -1,76 +1,34 @@
 #pragma once
 
-#include <cmath>
-#include <cstddef>
-
 #include <juce_core/juce_core.h>
 
-// rotating a phasor around the unit circle using a rotation matrix
+#include "OscillatorPolicy.hpp"
+
+// rotating a phasor around the unit circle
 //
 // std::sin is slower and we don't need "random access" anyways
 //
-// float rounding errors lead the phasor to eventually leave the unit circle so
-// a renorm from time to time is needed
-struct SineOscillator {
-    // vector [x y]
-    float m_cosv = 1.0f;
-    float m_sinv = 0.0f;
-
-    // rotation matrix coefficients
-    // cos th; -sin th
-    // sin th;  cos th
-    //
-    // default value is I_2
-    float m_sinInc = 0.0f;
-    float m_cosInc = 1.0f;
-
+// how the phasor is stored, rotated and kept on the unit circle is up to the
+// Policy, see OscillatorPolicy.hpp
+template <typename Policy>
+struct BasicSineOscillator : Policy {
     float m_sampleRate = 44100.0f;  // safeguard value but you should _really_
                                     // call setSampleRate before doing anything
 
-    size_t m_renormTimer = 0;
-    static constexpr size_t s_renormThreshold = 256;  // renorm every _ samples
-
     void setSampleRate(double sampleRate_)
     {
         m_sampleRate = static_cast<float>(sampleRate_);
     }
 
+    // the increment is computed in double, the policy rounds it to its own
+    // precision
     void setFrequency(float freq)
     {
-        const float phase_increment =
-            juce::MathConstants<float>::twoPi * freq / m_sampleRate;
-        m_cosInc = std::cos(phase_increment);
-        m_sinInc = std::sin(phase_increment);
-    }
-
-    void reset()
-    {
-        m_sinv = 0.0f;
-        m_cosv = 1.0f;
-        m_renormTimer = 0;
-    }
-
-    float sin() const { return m_sinv; }
-
-    float cos() const { return m_cosv; }
-
-    void advance()
-    {
-        // matrix multiplication
-        // c[n+1] = m_cosInc; -m_sinInc  x  c[n]
-        // s[n+1]   m_sinInc;  m_cosInc     s[n]
-        const float c = m_cosv * m_cosInc - m_sinv * m_sinInc;
-        const float s = m_sinv * m_cosInc + m_cosv * m_sinInc;
-
-        m_cosv = c;
-        m_sinv = s;
-
-        m_renormTimer++;
-        if (m_renormTimer >= s_renormThreshold) {
-            const float norm = std::hypot(m_sinv, m_cosv);
-            m_sinv /= norm;
-            m_cosv /= norm;
-            m_renormTimer = 0;
-        }
+        const double phase_increment =
+            juce::MathConstants<double>::twoPi * static_cast<double>(freq) /
+            static_cast<double>(m_sampleRate);
+        Policy::setIncrement(phase_increment);
     }
 };
+
+using SineOscillator = BasicSineOscillator<OscillatorPolicy::Rotation>;
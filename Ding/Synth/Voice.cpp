@@ -1,193 +1,725 @@
 #include "Voice.hpp"
 
-#include <atomic>
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
+#include "Decay.hpp"
+#include "Denormals.hpp"
+#include "ModalArena.hpp"
+#include "RotationTable.hpp"
 #include "core/DecibelLookup.hpp"
-
-namespace GlockenspielModalData {
-static constexpr std::array<float, nModes> frequencyRatios = {
-    1.0f,
-    2.7565361290810895f,
-    5.403921459425173f,
-    8.932951281230347f,
-    13.34429142562536f,
-    18.820878932628247f,
-};
-
-// gets multiplied at each sample so these parameters act pretty aggressively
-// the simply supported beams at 22.4% select the first and fifth partials
-//
-// in a perfect world, the first and fifth partials ring out forever but they
-// actually lose energy to acoustic radiation (i.e. we hear them)
-//
-// these should probably be physics based instead of randomly tuned
-static constexpr std::array<float, nModes> relativeDecays = {
-    1.0f, 0.95f, 0.9f, 0.7f, 1.0f, 0.5f,
-};
-
-// depends on the strike position
-// not implemented yet so 1.0f for everyone
-static constexpr std::array<float, nModes> initialAmplitude = {
-    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
-};
-
-}  // namespace GlockenspielModalData
+#include "core/Lookups.hpp"
+#include "core/VectorOps.hpp"
 
 namespace {
 namespace impl {
 // determines when the voice is absolutely silent and can be returned to the
 // voice pool
-static constexpr float silenceThresoldDecibel = -60.0f;
 static const float silenceThresold =
-    DecibelLookup::fromDb(silenceThresoldDecibel);
-
-// the level at which the envelope has _significantly_ decayed
-// makes the decay time more of a tau time constant than a time to silence
-static constexpr float guiDecayThreshold = -30.0f;
-
-// will become a GUI parameter at some point
-// so let's make it look like a gui parameter
-static std::atomic<float> guiDecayMs = 3000.0f;
-
-float computeDecayCoefficient(float decayMs,
-                              double sampleRate,
-                              float thresholdDecibel)
-{
-    // adsr[n+1] = k * adsr[n]
-    // ie adsr[n] = adsr[0] k^n = k^n
-    // we're looking for k such that adsr[n] = k^n = threshold
-    // with n = decaySeconds * sampleRate
-    // ie k = threshold^(1/n)
-    const float threshold = DecibelLookup::fromDb(thresholdDecibel);
-
-    // const float decaySamples =
-    // (decayMs / 1000.0f) * static_cast<float>(sampleRate);
-    const float invDecaySamples =
-        1000.0f / (decayMs * static_cast<float>(sampleRate));
-    const float decayCoeff = std::powf(threshold, invDecaySamples);
-
-    return decayCoeff;
-}
-
-static constexpr float nModesInv =
-    1.0f / static_cast<float>(GlockenspielModalData::nModes);
-
-// glockenspiels play pretty high
-// hard cut LPF: do not render stuff that will alias
-// soft knee LPF: HF modes are hard to excite and decay very fast
-static constexpr float hfHardCut = 18.0f * 1000.0f;
-static constexpr float hfSoftKnee = 10.0f * 1000.0f;
-
-// exponential rolloff + hard cut
-// std::expf is fine, this should only be called on NoteOn
-float hfAttenuation(float freq)
-{
-    if (freq >= hfHardCut) {
-        return 0.0f;
-    } else if (freq >= hfSoftKnee) {
-        // scale [softKnee, hardCut] to [0, 1]
-        float t = (freq - hfSoftKnee) / (hfHardCut - hfSoftKnee);
-        return std::expf(-3.0f * t);  // e^(-3) ≈ 0.05 at hardCut
-    } else {
-        return 1.0f;
-    }
-}
+    DecibelLookup::fromDb(Decay::s_silenceDecibel);
+
+// a single mode below this is dropped for the rest of the note
+// 12 modes at -90dB still sum way below the silence threshold
+static constexpr float modeFloorDecibel = -90.0f;
+static const float modeFloor = DecibelLookup::fromDb(modeFloorDecibel);
+
+// normalize using cached 1/N
+// makes sure samples are in [0, 1]
+template <typename Model>
+static constexpr float nModesInv = 1.0f / static_cast<float>(Model::nModes);
+
+// a mode bent up past this stops there instead of aliasing, same margin as
+// the note table
+static constexpr float maxPhaseIncrement =
+    0.45f * juce::MathConstants<float>::twoPi;
+
+// full pressure is a hand resting on the bar: it rings 10 times shorter
+static constexpr float pressureDamping = 9.0f;
+
+// the per voice engines render this many samples on the stack before
+// panning them to the output
+static constexpr int chunkSize = 64;
+static_assert(chunkSize % Denormals::s_snapInterval == 0);
 }  // namespace impl
 }  // namespace
 
-void Voice::setCurrentPlaybackSampleRate(double newRate)
+void Voice::setSampleRate(double newRate)
 {
     m_sampleRate = static_cast<float>(newRate);
-    for (auto& mode : m_modes) {
-        mode.osc.setSampleRate(newRate);
+    for (auto& osc : m_dampedModes) {
+        osc.setSampleRate(newRate);
     }
 }
 
-void Voice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
+template <typename Sample>
+void Voice::renderNextBlock(juce::AudioBuffer<Sample>& outputBuffer,
                             const int startSample,
-                            const int numSamples)
+                            const int numSamples,
+                            const NoteEvent* events)
+{
+    updateExpression();
+
+    // per segment, a note started by an event may be of another model
+    renderEvents(
+        startSample, numSamples, events, [&](const int start, const int n) {
+            dispatchModel(m_noteModel, [&](auto model) {
+                using Model = decltype(model);
+
+                switch (m_engine) {
+                    case RenderEngine::timeAxis:
+                        renderTimeAxis<Model>(outputBuffer, start, n);
+                        break;
+                    case RenderEngine::damped:
+                        renderDamped<Model>(outputBuffer, start, n);
+                        break;
+                    default:
+                        renderModes<Model>(outputBuffer, start, n);
+                        break;
+                }
+            });
+        });
+}
+
+template <typename RenderSegment>
+void Voice::renderEvents(const int startSample,
+                         const int numSamples,
+                         const NoteEvent* events,
+                         RenderSegment&& renderSegment)
+{
+    // only the voice's own events split its block, most blocks have none
+    int done = startSample;
+    for (; events != nullptr; events = events->next) {
+        jassert(events->position >= done);
+        if (events->position > done && isActive()) {
+            renderSegment(done, events->position - done);
+        }
+        done = events->position;
+        apply(*events);
+    }
+
+    const int end = startSample + numSamples;
+    if (done < end && isActive()) {
+        renderSegment(done, end - done);
+    }
+}
+
+void Voice::apply(const NoteEvent& event)
 {
+    switch (event.type) {
+        case NoteEvent::Type::restrike:
+            // it may have gone silent earlier in the block
+            if (isActive()) {
+                restrike(event.velocity);
+                break;
+            }
+            [[fallthrough]];
+        case NoteEvent::Type::start:
+            startNote(event.channel, event.note, event.velocity,
+                      event.timbre);
+            break;
+    }
+}
+
+template <typename Model, typename Sample>
+void Voice::renderModes(juce::AudioBuffer<Sample>& outputBuffer,
+                        const int startSample,
+                        const int numSamples)
+{
+    auto& modeBank = bank<Sample>();
+
     // check the master decay env. for voice inactivity
     // samples cannot be larger than m_level
     if (m_level <= impl::silenceThresold) {
-        clearCurrentNote();
+        clear();
+        return;
+    }
+
+    // the mode levels do not include the master envelope
+    modeBank.cull(impl::modeFloor / m_level);
+    if (modeBank.liveModes() == 0) {
+        clear();
         return;
     }
+    m_amplitude = m_level * modeBank.amplitude() * impl::nModesInv<Model>;
 
-    const float decayMs = impl::guiDecayMs.load(std::memory_order_relaxed);
-    m_decayCoeff = impl::computeDecayCoefficient(decayMs, m_sampleRate,
-                                                 impl::guiDecayThreshold);
+    const bool gliding = m_glideDepth > 0.0f;
+    alignas(64) std::array<Sample, impl::chunkSize> chunk;
 
-    const int channels = outputBuffer.getNumChannels();
+    for (int done = 0; done < numSamples; done += impl::chunkSize) {
+        const int n = std::min(impl::chunkSize, numSamples - done);
+        for (int snapped = 0; snapped < n;
+             snapped += Denormals::s_snapInterval) {
+            const int end = std::min(n, snapped + Denormals::s_snapInterval);
+            for (int sampleIdx = snapped; sampleIdx < end; ++sampleIdx) {
+                // the mode amplitudes are the lane levels times m_level
+                const Sample modes =
+                    gliding ? modeBank.template tickGliding<Model::nModes>(
+                                  m_glideDepth * m_level * m_level)
+                            : modeBank.template tick<Model::nModes>();
+                const Sample sample = modes * impl::nModesInv<Model>;
 
-    for (int sampleIdx = 0; sampleIdx < numSamples; ++sampleIdx) {
-        float sample = 0.0f;
-        for (std::size_t i = 0; i < s_nModes; i++) {
-            Mode& mode = m_modes[i];
-            sample += mode.osc.sin() * mode.level;
-            mode.osc.advance();
-            mode.level *= GlockenspielModalData::relativeDecays[i];
+                // master decay enveloppe
+                chunk[static_cast<std::size_t>(sampleIdx)] = sample * m_level;
+                m_level *= m_voiceDecay;
+            }
+            modeBank.snapToZero();
         }
-        sample *= impl::nModesInv;  // normalize using cached 1/N
-                                    // makes sure sample is in [0, 1]
+        addPanned(outputBuffer, startSample + done, chunk.data(), n);
+    }
+
+    // one renorm for the whole block instead of one timer per mode
+    modeBank.template renormalize<Model::nModes>();
+}
 
-        // master decay enveloppe
-        const float s = sample * m_level;
-        m_level *= m_decayCoeff;
+template <typename Model, typename Sample>
+void Voice::renderTimeAxis(juce::AudioBuffer<Sample>& outputBuffer,
+                           const int startSample,
+                           const int numSamples)
+{
+    auto& modeBank = bank<Sample>();
 
-        for (int ch = 0; ch < channels; ++ch) {
-            outputBuffer.addSample(ch, startSample + sampleIdx, s);
+    // the mode levels include the master envelope, their sum bounds the output
+    modeBank.cull(impl::modeFloor);
+    m_amplitude = modeBank.amplitude();
+    if (m_amplitude <= impl::silenceThresold) {
+        clear();
+        return;
+    }
+
+    modeBank.template prepareTimeAxis<Model::nModes>(m_voiceDecay);
+
+    static_assert(impl::chunkSize %
+                      ModalBank<s_maxModes, Sample>::s_laneWidth ==
+                  0);
+    alignas(64) std::array<Sample, impl::chunkSize> chunk;
+
+    for (int done = 0; done < numSamples; done += impl::chunkSize) {
+        const int n = std::min(impl::chunkSize, numSamples - done);
+        modeBank.template renderTimeAxis<Model::nModes>(chunk.data(), n);
+        addPanned(outputBuffer, startSample + done, chunk.data(), n);
+    }
+
+    modeBank.template renormalize<Model::nModes>();
+}
+
+template <typename Model, typename Sample>
+void Voice::renderDamped(juce::AudioBuffer<Sample>& outputBuffer,
+                         const int startSample,
+                         const int numSamples)
+{
+    // the phasor magnitudes are the mode levels, envelope included
+    // inaudible modes are dropped, the last live one takes their place
+    float amplitude = 0.0f;
+    std::size_t i = 0;
+    while (i < m_nDampedModes) {
+        const float level = m_dampedModes[i].level();
+        if (level < impl::modeFloor) {
+            --m_nDampedModes;
+            m_dampedModes[i] = m_dampedModes[m_nDampedModes];
+            m_dampedDecays[i] = m_dampedDecays[m_nDampedModes];
+            m_dampedModeOf[i] = m_dampedModeOf[m_nDampedModes];
+            continue;
         }
+        amplitude += level;
+        ++i;
+    }
+    m_amplitude = amplitude;
+    if (amplitude <= impl::silenceThresold) {
+        clear();
+        return;
+    }
+
+    jassert(m_nDampedModes <= Model::nModes);
+    for (i = 0; i < m_nDampedModes; i++) {
+        m_dampedModes[i].setDecay(m_dampedDecays[i] * m_voiceDecay);
+    }
+
+    alignas(64) std::array<float, impl::chunkSize> chunk;
+
+    for (int done = 0; done < numSamples; done += impl::chunkSize) {
+        const int n = std::min(impl::chunkSize, numSamples - done);
+        for (int snapped = 0; snapped < n;
+             snapped += Denormals::s_snapInterval) {
+            const int end = std::min(n, snapped + Denormals::s_snapInterval);
+            for (int sampleIdx = snapped; sampleIdx < end; ++sampleIdx) {
+                float sample = 0.0f;
+                for (i = 0; i < m_nDampedModes; i++) {
+                    sample += m_dampedModes[i].sin();
+                    m_dampedModes[i].advance();
+                }
+                chunk[static_cast<std::size_t>(sampleIdx)] = sample;
+            }
+            for (i = 0; i < m_nDampedModes; i++) {
+                m_dampedModes[i].snapToZero();
+            }
+        }
+        addPanned(outputBuffer, startSample + done, chunk.data(), n);
     }
 }
 
-void Voice::startNote(const int midiNote,
+void Voice::startNote(const int channel,
+                      const int midiNote,
                       const float velocity,
-                      juce::SynthesiserSound* /* sound */,
-                      const int /*pitchWheelPosition*/)
+                      const float timbre)
+{
+    m_channel = channel;
+    m_note = midiNote;
+    m_noteModel = m_model;
+
+    dispatchModel(m_noteModel, [&](auto model) {
+        startModes<decltype(model)>(midiNote, velocity, timbre);
+    });
+
+    // the modes start unbent and undamped, catch up with the channel
+    m_bend = 0.0f;
+    m_bendRatio = 1.0f;
+    m_pressure = 0.0f;
+    m_voiceDecay = m_masterDecay;
+    updateExpression();
+    updatePan();
+}
+
+template <typename Model>
+void Voice::startModes(const int midiNote,
+                       const float velocity,
+                       const float timbre)
 {
-    const auto fundamental =
-        static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(midiNote));
+    jassert(m_noteTable != nullptr);
+    ModeParameters modes = m_noteTable->get(m_noteModel, midiNote);
+    jassert(modes.nModes <= Model::nModes);
+
+    m_nNoteModes = modes.nModes;
+    for (std::size_t i = 0; i < modes.nModes; i++) {
+        m_noteModes[i] = modes.modeIndices[i];
+        m_phaseByMode[modes.modeIndices[i]] = modes.phaseIncrements[i];
+    }
+
+    // timbre is the mallet: below the neutral 0.5 it gets softer and the
+    // upper modes are struck less, 1 / ratio at the softest
+    const float softness = std::clamp((0.5f - timbre) * 2.0f, 0.0f, 1.0f);
+    if (softness > 0.0f) {
+        for (std::size_t i = 0; i < modes.nModes; i++) {
+            const float ratio = Model::frequencyRatios[modes.modeIndices[i]] /
+                                Model::frequencyRatios[0];
+            modes.levels[i] /= 1.0f + softness * (ratio - 1.0f);
+        }
+    }
+
+    float amplitude = 0.0f;
+    for (std::size_t i = 0; i < modes.nModes; i++) {
+        amplitude += modes.levels[i];
+    }
+    m_amplitude = amplitude * velocity * impl::nModesInv<Model>;
+
+    m_strikeLevels.fill(0.0f);
+    if (m_engine == RenderEngine::perVoice) {
+        std::copy_n(modes.levels.begin(), modes.nModes,
+                    m_strikeLevels.begin());
+    } else {
+        // no separate master envelope, fold velocity and 1/N in the mode
+        // levels instead
+        // 1/N of the whole model so dropped modes don't make a note louder
+        for (std::size_t i = 0; i < modes.nModes; i++) {
+            m_strikeLevels[i] = modes.levels[i] * impl::nModesInv<Model>;
+            modes.levels[i] = m_strikeLevels[i] * velocity;
+        }
+    }
+
+    if (m_engine == RenderEngine::arena) {
+        m_arena->start(m_id, modes);
+        return;
+    }
 
-    const std::array<float, s_nModes>& ratios =
-        GlockenspielModalData::frequencyRatios;
+    if (m_engine == RenderEngine::resonator) {
+        // a stolen voice must not carry the energy of its previous note
+        m_resonators.clear();
+        for (std::size_t i = 0; i < modes.nModes; i++) {
+            m_resonators.setMode(i, static_cast<float>(modes.cosIncs[i]),
+                                 static_cast<float>(modes.sinIncs[i]),
+                                 modes.relativeDecays[i], modes.levels[i]);
+        }
+        m_resonators.strike(modes.levels);
+        return;
+    }
 
-    for (std::size_t i = 0; i < s_nModes; i++) {
-        Mode& mode = m_modes[i];
-        const float freq = fundamental * ratios[i];
-        mode.osc.setFrequency(freq);
-        mode.osc.reset();
-        // hard cut around 18kHz to avoid aliasing
-        // soft knee around 10kHz to attenuate the 10k-20k octave
-        mode.level = GlockenspielModalData::initialAmplitude[i] *
-                     impl::hfAttenuation(freq);
+    if (m_engine == RenderEngine::damped) {
+        m_nDampedModes = modes.nModes;
+        for (std::size_t i = 0; i < modes.nModes; i++) {
+            DampedModeOscillator& osc = m_dampedModes[i];
+            osc.setIncrement(static_cast<float>(modes.cosIncs[i]),
+                             static_cast<float>(modes.sinIncs[i]));
+            osc.reset(modes.levels[i]);
+            m_dampedDecays[i] = modes.relativeDecays[i];
+            m_dampedModeOf[i] = modes.modeIndices[i];
+        }
+        return;
     }
 
+    withBank([&](auto& bank) {
+        bank.clear();
+        for (std::size_t i = 0; i < modes.nModes; i++) {
+            bank.addMode(modes.modeIndices[i], modes.phaseIncrements[i],
+                         modes.cosIncs[i], modes.sinIncs[i], modes.levels[i],
+                         modes.relativeDecays[i]);
+        }
+    });
+
     m_level = velocity;
 }
 
-void Voice::stopNote(const float /* velocity */, const bool allowTailOff)
+template <typename Model>
+void Voice::restrikeModes(const float velocity)
 {
-    if (!allowTailOff) {
-        clearCurrentNote();
+    jassert(m_noteTable != nullptr);
+    const ModeParameters& modes = m_noteTable->get(m_noteModel, m_note);
+    jassert(modes.nModes == m_nNoteModes);
+
+    std::array<float, s_maxModes> levels{};
+    float amplitude = 0.0f;
+    for (std::size_t i = 0; i < modes.nModes; i++) {
+        levels[i] = m_strikeLevels[i] * velocity;
+        amplitude += levels[i];
+    }
+    // good enough for stealing until the next render, it can only be lower
+    m_amplitude += m_engine == RenderEngine::perVoice
+                       ? amplitude * impl::nModesInv<Model>
+                       : amplitude;
+
+    if (m_engine == RenderEngine::arena) {
+        m_arena->strike(m_id, levels);
+        return;
+    }
+
+    if (m_engine == RenderEngine::resonator) {
+        m_resonators.strike(levels);
+        return;
+    }
+
+    if (m_engine == RenderEngine::damped) {
+        for (std::size_t j = 0; j < modes.nModes; j++) {
+            const std::uint8_t mode = modes.modeIndices[j];
+            std::size_t i = 0;
+            while (i < m_nDampedModes && m_dampedModeOf[i] != mode) {
+                ++i;
+            }
+            if (i < m_nDampedModes) {
+                m_dampedModes[i].strike(levels[j]);
+                continue;
+            }
+
+            // culled since, back at phase 0
+            const auto rotation =
+                RotationTable::lookup(bentPhaseIncrement(mode));
+            m_dampedModes[i].setIncrement(rotation.cos, rotation.sin);
+            m_dampedModes[i].reset(levels[j]);
+            m_dampedDecays[i] = modes.relativeDecays[j];
+            m_dampedModeOf[i] = mode;
+            ++m_nDampedModes;
+        }
+        return;
+    }
+
+    // perVoice: the lanes are relative to m_level, which can only go up
+    if (m_engine == RenderEngine::perVoice) {
+        const float level = std::max(m_level, velocity);
+        withBank([&](auto& bank) { bank.scaleLevels(m_level / level); });
+        for (float& l : levels) {
+            l /= level;
+        }
+        m_level = level;
     }
-    // else renderBlock will take care of clearing the note
+
+    withBank([&](auto& bank) {
+        for (std::size_t j = 0; j < modes.nModes; j++) {
+            const std::uint8_t mode = modes.modeIndices[j];
+            const float phaseIncrement = bentPhaseIncrement(mode);
+            const auto rotation = RotationTable::lookup(phaseIncrement);
+            bank.strike(mode, phaseIncrement, static_cast<double>(rotation.cos),
+                        static_cast<double>(rotation.sin), levels[j],
+                        modes.relativeDecays[j]);
+        }
+    });
+}
+
+void Voice::stop()
+{
+    if (isActive() && m_engine == RenderEngine::arena) {
+        m_arena->stop(m_id);
+    }
+    clear();
+}
+
+void Voice::clear()
+{
+    m_note = -1;
+    m_amplitude = 0.0f;
+}
+
+template <typename Sample>
+void Voice::renderResonator(juce::AudioBuffer<Sample>& outputBuffer,
+                            const int startSample,
+                            const int numSamples,
+                            const NoteEvent* events,
+                            const float* excitation)
+{
+    updateExpression();
+
+    renderEvents(
+        startSample, numSamples, events, [&](const int start, const int n) {
+            dispatchModel(m_noteModel, [&](auto model) {
+                renderResonatorModes<decltype(model)>(
+                    outputBuffer, start, n,
+                    excitation != nullptr ? excitation + (start - startSample)
+                                          : nullptr);
+            });
+        });
+}
+
+template <typename Model, typename Sample>
+void Voice::renderResonatorModes(juce::AudioBuffer<Sample>& outputBuffer,
+                                 const int startSample,
+                                 const int numSamples,
+                                 const float* excitation)
+{
+    if (!isActive()) {
+        return;
+    }
+
+    // a held note keeps listening to the excitation even when silent
+    m_amplitude = m_resonators.amplitude();
+    if (m_amplitude <= impl::silenceThresold) {
+        if (!isHeld()) {
+            clear();
+            return;
+        }
+        if (excitation == nullptr) {
+            return;
+        }
+    }
+
+    m_resonators.prepare<Model::nModes>(m_voiceDecay);
+
+    alignas(64) std::array<float, impl::chunkSize> chunk;
+
+    for (int done = 0; done < numSamples; done += impl::chunkSize) {
+        const int n = std::min(impl::chunkSize, numSamples - done);
+        for (int snapped = 0; snapped < n;
+             snapped += Denormals::s_snapInterval) {
+            const int end = std::min(n, snapped + Denormals::s_snapInterval);
+            for (int sampleIdx = snapped; sampleIdx < end; ++sampleIdx) {
+                chunk[static_cast<std::size_t>(sampleIdx)] =
+                    excitation != nullptr
+                        ? m_resonators.tick<Model::nModes>(
+                              excitation[done + sampleIdx])
+                        : m_resonators.tick<Model::nModes>();
+            }
+            m_resonators.snapToZero();
+        }
+        addPanned(outputBuffer, startSample + done, chunk.data(), n);
+    }
+}
+
+template <typename Sample, typename ChunkSample>
+void Voice::addPanned(juce::AudioBuffer<Sample>& outputBuffer,
+                      const int startSample,
+                      const ChunkSample* chunk,
+                      const int numSamples) const
+{
+    const int channels = outputBuffer.getNumChannels();
+    if (channels == 1) {
+        VectorOps::addWithMultiply(
+            outputBuffer.getWritePointer(0, startSample), chunk,
+            static_cast<Sample>(0.5f * (m_pan.left + m_pan.right)),
+            numSamples);
+        return;
+    }
+
+    for (int ch = 0; ch < channels; ++ch) {
+        VectorOps::addWithMultiply(
+            outputBuffer.getWritePointer(ch, startSample), chunk,
+            static_cast<Sample>(ch % 2 == 0 ? m_pan.left : m_pan.right),
+            numSamples);
+    }
+}
+
+void Voice::restrike(const float velocity)
+{
+    jassert(isActive());
+    dispatchModel(m_noteModel, [&](auto model) {
+        restrikeModes<decltype(model)>(velocity);
+    });
+}
+
+void Voice::setEngine(const RenderEngine engine, ModalArena* arena)
+{
+    m_engine = engine;
+    m_arena = arena;
+}
+
+void Voice::setModel(const ModelId model)
+{
+    m_model = model;
+}
+
+void Voice::setNoteTable(const NoteTable* noteTable)
+{
+    m_noteTable = noteTable;
+}
+
+void Voice::syncWithArena()
+{
+    if (!isActive()) {
+        return;
+    }
+
+    // the lane levels already include the master envelope
+    m_amplitude = m_arena->amplitude(m_id);
+    if (m_amplitude <= impl::silenceThresold) {
+        m_arena->stop(m_id);
+        clear();
+    }
+}
+
+void Voice::setDoublePrecision(const bool doublePrecision)
+{
+    jassert(!isActive());
+    m_doublePrecision = doublePrecision;
+}
+
+void Voice::setMasterDecay(const float masterDecay,
+                           const float logMasterDecay)
+{
+    m_masterDecay = masterDecay;
+    m_logMasterDecay = logMasterDecay;
+    updateVoiceDecay();
+}
+
+void Voice::setGlideDepth(const float glideDepth)
+{
+    m_glideDepth = glideDepth;
+}
+
+void Voice::setStereo(const float width, const bool decorrelate)
+{
+    m_width = width;
+    m_decorrelate = decorrelate;
+    if (isActive()) {
+        updatePan();
+    }
+}
+
+void Voice::updatePan()
+{
+    const float bar = Pan::barPosition(m_note);
+    m_pan = Pan::gains(m_width * bar);
+
+    if (m_engine != RenderEngine::arena) {
+        return;
+    }
+    if (!m_decorrelate) {
+        m_arena->setPan(m_id, m_nNoteModes,
+                        [&](std::size_t) { return m_pan; });
+        return;
+    }
+    m_arena->setPan(m_id, m_nNoteModes, [&](const std::size_t j) {
+        return Pan::gains(m_width * Pan::modePosition(bar, m_noteModes[j]));
+    });
 }
 
-void Voice::pitchWheelMoved(const int newPitchWheelValue)
+void Voice::setMpeState(const MpeState* mpe)
 {
-    (void)newPitchWheelValue;
+    m_mpe = mpe;
 }
-void Voice::controllerMoved(const int controllerNumber,
-                            int const newControllerValue)
+
+void Voice::updateExpression()
 {
-    (void)controllerNumber;
-    (void)newControllerValue;
+    if (m_mpe == nullptr || !isActive()) {
+        return;
+    }
+
+    const float bend = m_mpe->bend(m_channel);
+    if (bend != m_bend) {
+        m_bend = bend;
+        // no transcendental at all, tables only
+        m_bendRatio = Lookups::SemitonesToRatio::evaluate(bend);
+        retune();
+    }
+
+    const float pressure = m_mpe->pressure(m_channel);
+    if (pressure != m_pressure) {
+        m_pressure = pressure;
+        updateVoiceDecay();
+    }
 }
 
-bool Voice::canPlaySound(juce::SynthesiserSound* sound)
+void Voice::retune()
 {
-    return dynamic_cast<SynthSound*>(sound) != nullptr;
+    const auto phaseIncrementOf = [&](std::size_t mode) {
+        return bentPhaseIncrement(mode);
+    };
+    const auto rotationOfMode = [&](std::size_t mode) {
+        return RotationTable::lookup(bentPhaseIncrement(mode));
+    };
+    const auto rotationOfEntry = [&](std::size_t j) {
+        return rotationOfMode(m_noteModes[j]);
+    };
+
+    switch (m_engine) {
+        case RenderEngine::arena:
+            m_arena->retune(m_id, m_nNoteModes, rotationOfEntry);
+            break;
+        case RenderEngine::resonator:
+            m_resonators.retune(rotationOfEntry);
+            break;
+        case RenderEngine::damped:
+            // renderDamped rebuilds the damped rotations from these
+            for (std::size_t i = 0; i < m_nDampedModes; i++) {
+                const auto rotation = rotationOfMode(m_dampedModeOf[i]);
+                m_dampedModes[i].setIncrement(rotation.cos, rotation.sin);
+            }
+            break;
+        default:
+            withBank([&](auto& bank) { bank.retune(phaseIncrementOf); });
+            break;
+    }
 }
+
+float Voice::bentPhaseIncrement(const std::size_t mode) const
+{
+    return std::min(m_phaseByMode[mode] * m_bendRatio,
+                    impl::maxPhaseIncrement);
+}
+
+void Voice::updateVoiceDecay()
+{
+    // the arena engine ignores this, its lanes decay with the synth wide
+    // master decay
+    // masterDecay^(1 + damping * pressure) through its log, a full pressure
+    // on a short decay runs off the table and clamps to the fastest decay
+    m_voiceDecay = m_pressure > 0.0f
+                       ? Lookups::ExpDecay::evaluate(
+                             m_logMasterDecay *
+                             (1.0f + impl::pressureDamping * m_pressure))
+                       : m_masterDecay;
+}
+
+// the precisions DingSynth renders in
+template void Voice::renderNextBlock(juce::AudioBuffer<float>&,
+                                     int,
+                                     int,
+                                     const NoteEvent*);
+template void Voice::renderNextBlock(juce::AudioBuffer<double>&,
+                                     int,
+                                     int,
+                                     const NoteEvent*);
+template void Voice::renderResonator(juce::AudioBuffer<float>&,
+                                     int,
+                                     int,
+                                     const NoteEvent*,
+                                     const float*);
+template void Voice::renderResonator(juce::AudioBuffer<double>&,
+                                     int,
+                                     int,
+                                     const NoteEvent*,
+                                     const float*);
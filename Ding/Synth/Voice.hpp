@@ -1,58 +1,282 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
+#include <type_traits>
 
 #include <juce_audio_basics/juce_audio_basics.h>
 
-#include "SineOscillator.hpp"
+#include "DampedModeOscillator.hpp"
+#include "ModalBank.hpp"
+#include "ModalModel.hpp"
+#include "MpeState.hpp"
+#include "NoteTable.hpp"
+#include "Pan.hpp"
+#include "RenderEngine.hpp"
+#include "ResonatorBank.hpp"
 
-namespace GlockenspielModalData {
-static constexpr std::size_t nModes = 6;
-}
+class ModalArena;
 
-class SynthSound final : public juce::SynthesiserSound {
-   public:
-    SynthSound() = default;
-    bool appliesToNote(int) override { return true; }
-    bool appliesToChannel(int) override { return true; }
-    ~SynthSound() override = default;
+// a note event inside the block being rendered, DingSynth schedules them on
+// the voices before rendering so a voice renders its whole block in one go
+// and still starts every note on the right sample
+struct NoteEvent {
+    enum class Type {
+        // new note, whatever the voice was playing
+        start,
+        // strikes the ringing note again, starts it if it has gone silent
+        restrike,
+    };
+
+    Type type;
+    // sample of the output buffer
+    int position;
+    int channel;
+    int note;
+    float velocity;
+    // of the channel at the time of the event, see MpeState
+    float timbre;
+    // next event of the same voice in the block, or nullptr
+    const NoteEvent* next;
 };
 
-class Voice final : public juce::SynthesiserVoice {
+// one note at a time, started, struck again and stopped by DingSynth
+//
+// a note rings on after its key goes up, until it is silent or stolen, the
+// key only matters to the resonator engine whose held notes keep listening
+// to the excitation
+//
+// the per voice engines render mono chunks on the stack and add them to the
+// output with one pan gain per channel, see Pan.hpp
+//
+// the output is float or double, whatever the host's buffers are
+// the modes of the perVoice and timeAxis engines are rendered in that
+// precision, the other engines render float and widen as they add
+class Voice final {
    public:
-    Voice() = default;
+    // id is the index of the voice in the synth, used as a key in the arena
+    explicit Voice(std::size_t id) : m_id(id) {}
     // this is effectively the constructor
-    void setCurrentPlaybackSampleRate(double newRate) override;
+    void setSampleRate(double newRate);
+
+    // adds the voice to outputBuffer, per voice engines only
+    // events are the note events of the voice in the block, in order, or
+    // nullptr, each one is applied on its sample
+    // Sample must match setDoublePrecision
+    template <typename Sample>
+    void renderNextBlock(juce::AudioBuffer<Sample>& outputBuffer,
+                         int startSample,
+                         int numSamples,
+                         const NoteEvent* events);
+
+    // timbre is the one of the channel, see MpeState
+    void startNote(int channel, int midiNote, float velocity, float timbre);
+    // strikes the ringing note again: the strike adds to every mode, phase
+    // and level included, so nothing jumps and a bar struck twice rings
+    // louder
+    void restrike(float velocity);
+    // silent right away
+    void stop();
+    // the event right away, whatever its position, the arena engine has no
+    // per voice render to schedule it in
+    void apply(const NoteEvent& event);
 
-    void renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
+    bool isActive() const { return m_note >= 0; }
+    int note() const { return m_note; }
+    int channel() const { return m_channel; }
+
+    // the synth keeps these up to date as the events come, notes started
+    // later in the block included
+    void setKeyDown(bool keyDown) { m_keyDown = keyDown; }
+    // key up while the sustain pedal of the channel is down
+    void setSustained(bool sustained) { m_sustained = sustained; }
+    bool isHeld() const { return isActive() && (m_keyDown || m_sustained); }
+
+    // upper bound of the output as of the last render, what stealing goes by
+    float amplitude() const { return m_amplitude; }
+
+    // arena engine: the modes live in the arena which renders every voice at
+    // once, the voice only starts, stops and retires notes
+    // the other engines render from the voice's own banks
+    void setEngine(RenderEngine engine, ModalArena* arena);
+    // takes effect on the next note, a ringing one keeps its model
+    void setModel(ModelId model);
+    // where note on reads its modes from, owned by the synth
+    void setNoteTable(const NoteTable* noteTable);
+    // arena engine: retires the note once the arena says it's silent
+    void syncWithArena();
+
+    // resonator engine: excitation is one mono sample per output sample or
+    // nullptr, it excites the modes of every held note
+    // events as for renderNextBlock
+    template <typename Sample>
+    void renderResonator(juce::AudioBuffer<Sample>& outputBuffer,
                          int startSample,
-                         int numSamples) override;
+                         int numSamples,
+                         const NoteEvent* events,
+                         const float* excitation);
+
+    // the precision of the output buffers and of the modes, see the class
+    // comment
+    // the banks don't share state, call it when the voice is idle
+    void setDoublePrecision(bool doublePrecision);
+
+    // per sample coefficient of the master decay envelope, see Decay.hpp,
+    // and its log
+    // the synth pushes them whenever they change
+    void setMasterDecay(float masterDecay, float logMasterDecay);
 
-    void startNote(int midiNote,
-                   float velocity,
-                   juce::SynthesiserSound* sound,
-                   int /*pitchWheelPosition*/) override;
-    void stopNote(float velocity, bool allowTailOff) override;
+    // relative frequency deviation of a mode at full amplitude, see
+    // Glide.hpp, 0 is off
+    // only the perVoice engine glides, the synth pushes it whenever it changes
+    void setGlideDepth(float glideDepth);
 
-    void pitchWheelMoved(int newPitchWheelValue) override;
-    void controllerMoved(int controllerNumber, int newControllerValue) override;
+    // stereo width in [0, 1], 0 is mono, see Pan.hpp
+    // only the arena engine decorrelates modes, its lanes have their own
+    // gains anyway, the others pan the note as a whole
+    // the synth pushes them whenever they change
+    void setStereo(float width, bool decorrelate);
 
-    bool canPlaySound(juce::SynthesiserSound* sound) override;
+    // per note expression, owned by the synth
+    void setMpeState(const MpeState* mpe);
+    // follows the bend and pressure of the note's channel, cheap when they
+    // don't move
+    // the voice does it at the start of every block it renders itself, the
+    // synth does it for the arena engine
+    void updateExpression();
 
    private:
-    static constexpr std::size_t s_nModes = GlockenspielModalData::nModes;
+    // no note, idle until the next startNote
+    void clear();
 
-    struct Mode {
-        SineOscillator osc;
-        float level;
-    };
-    std::array<Mode, s_nModes> m_modes;
+    // renderSegment(startSample, numSamples) between the events, while
+    // there is a note
+    template <typename RenderSegment>
+    void renderEvents(int startSample,
+                      int numSamples,
+                      const NoteEvent* events,
+                      RenderSegment&& renderSegment);
+
+    // pitch bend: rotates every mode by its note on increment times the bend
+    // ratio, table lookups only
+    void retune();
+    // radians per sample of mode `mode` of the model, bend included
+    float bentPhaseIncrement(std::size_t mode) const;
+    // master decay with the pressure damping on top
+    void updateVoiceDecay();
+    // the gains of the note, and of its lanes in the arena
+    void updatePan();
+
+    // a mono chunk of the note to every channel, even channels are left
+    template <typename Sample, typename ChunkSample>
+    void addPanned(juce::AudioBuffer<Sample>& outputBuffer,
+                   int startSample,
+                   const ChunkSample* chunk,
+                   int numSamples) const;
+
+    // the bank the kernels of output type Sample render from
+    template <typename Sample>
+    ModalBank<s_maxModes, Sample>& bank()
+    {
+        if constexpr (std::is_same_v<Sample, double>) {
+            return m_doubleBank;
+        } else {
+            return m_bank;
+        }
+    }
+    // f(bank) with the bank of the current precision, for what happens
+    // outside of rendering
+    template <typename F>
+    void withBank(F&& f)
+    {
+        if (m_doublePrecision) {
+            f(m_doubleBank);
+        } else {
+            f(m_bank);
+        }
+    }
+
+    // one specialization per model, picked by dispatchModel once per call
+    template <typename Model>
+    void startModes(int midiNote, float velocity, float timbre);
+    template <typename Model>
+    void restrikeModes(float velocity);
+
+    template <typename Model, typename Sample>
+    void renderModes(juce::AudioBuffer<Sample>& outputBuffer,
+                     int startSample,
+                     int numSamples);
+    template <typename Model, typename Sample>
+    void renderTimeAxis(juce::AudioBuffer<Sample>& outputBuffer,
+                        int startSample,
+                        int numSamples);
+    template <typename Model, typename Sample>
+    void renderDamped(juce::AudioBuffer<Sample>& outputBuffer,
+                      int startSample,
+                      int numSamples);
+    template <typename Model, typename Sample>
+    void renderResonatorModes(juce::AudioBuffer<Sample>& outputBuffer,
+                              int startSample,
+                              int numSamples,
+                              const float* excitation);
+
+    // sized for the largest model, the kernels only touch what the current
+    // one uses
+    // one per precision, only the current one is used
+    ModalBank<s_maxModes> m_bank;
+    ModalBank<s_maxModes, double> m_doubleBank;
+    bool m_doublePrecision = false;
+    // damped engine: live modes first, same culling as ModalBank
+    std::array<DampedModeOscillator, s_maxModes> m_dampedModes;
+    std::array<float, s_maxModes> m_dampedDecays{};
+    std::array<std::uint8_t, s_maxModes> m_dampedModeOf{};
+    std::size_t m_nDampedModes = 0;
+    ResonatorBank<s_maxModes> m_resonators;
+    // strike of the current note for a velocity of 1, by entry of its
+    // ModeParameters, 1/N included unless the engine is perVoice
+    std::array<float, s_maxModes> m_strikeLevels{};
+
+    std::size_t m_id;
+    RenderEngine m_engine = RenderEngine::perVoice;
+    ModalArena* m_arena = nullptr;
+    const NoteTable* m_noteTable = nullptr;
+    ModelId m_model = ModelId::glockenspiel;
+    // of the current note
+    ModelId m_noteModel = ModelId::glockenspiel;
+
+    // -1 when idle
+    int m_note = -1;
+    int m_channel = 1;
+    bool m_keyDown = false;
+    bool m_sustained = false;
+    float m_amplitude = 0.0f;
+
+    // expression of the current note, see updateExpression
+    const MpeState* m_mpe = nullptr;
+    float m_bend = 0.0f;  // semitones, as applied to the modes
+    float m_bendRatio = 1.0f;
+    float m_pressure = 0.0f;
+    // unbent phase increment of every mode of the model, indexed by mode
+    std::array<float, s_maxModes> m_phaseByMode{};
+    // entry j of the note's ModeParameters, for the arena and resonator
+    // engines whose lanes are in that order
+    std::array<std::uint8_t, s_maxModes> m_noteModes{};
+    std::size_t m_nNoteModes = 0;
+
+    float m_glideDepth = 0.0f;
+
+    float m_width = Pan::s_defaultWidth;
+    bool m_decorrelate = false;
+    Pan::Gains m_pan{1.0f, 1.0f};
 
-    // master decay
-    float m_decayCoeff = 1.0f;
+    float m_masterDecay = 1.0f;
+    float m_logMasterDecay = 0.0f;
+    // m_masterDecay damped by the pressure, what the per voice engines use
+    float m_voiceDecay = 1.0f;
+    // master envelope, only used by the perVoice engine, the others fold it
+    // in the mode levels
     float m_level = 0.0f;
 
-    float m_sampleRate =
-        44100.0f;  // safeguard value but you should _really_  call
-                   // setCurrentPlaybackSampleRate before doing anything
+    float m_sampleRate = 44100.0f;  // safeguard value but you should _really_
+                                    // call setSampleRate before doing anything
 };
@@ -0,0 +1,157 @@
+#include "VoiceManager.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <juce_core/juce_core.h>
+
+namespace {
+namespace impl {
+// exponent and first mantissa bit of a positive float, i.e. its log2 in
+// half octaves, plus a constant
+static int halfOctaves(const float x)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return static_cast<int>(bits >> 22);
+}
+
+// ~-60dB, the bottom of the first bucket
+static const int floorHalfOctaves = halfOctaves(1.0f / 1024.0f);
+}  // namespace impl
+}  // namespace
+
+void VoiceManager::prepare(const std::size_t nVoices)
+{
+    jassert(nVoices < s_free);
+
+    m_order.resize(nVoices);
+    m_position.resize(nVoices);
+    // voice 0 on top, the first notes get the first voices
+    for (std::size_t i = 0; i < nVoices; ++i) {
+        m_order[i] = static_cast<std::uint16_t>(nVoices - 1 - i);
+        m_position[nVoices - 1 - i] = static_cast<std::uint16_t>(i);
+    }
+    m_nFree = nVoices;
+
+    m_voiceOfNote.fill(s_noVoice);
+    m_channelNote.assign(nVoices, s_free);
+
+    m_head.fill(s_noVoice);
+    m_tail.fill(s_noVoice);
+    m_prev.assign(nVoices, s_noVoice);
+    m_next.assign(nVoices, s_noVoice);
+    m_bucket.assign(nVoices, 0);
+}
+
+int VoiceManager::voiceFor(const int channel, const int note) const
+{
+    return m_voiceOfNote[key(channel, note)];
+}
+
+VoiceManager::Allocation VoiceManager::allocate(const int channel,
+                                                const int note)
+{
+    jassert(voiceFor(channel, note) == s_noVoice);
+    jassert(size() > 0);
+
+    Allocation allocation{0, false};
+    if (m_nFree > 0) {
+        // the top of the stack is already where the first sounding voice
+        // goes
+        allocation.voice = m_order[--m_nFree];
+    } else {
+        // there is always a sounding voice when none is free
+        std::size_t bucket = 0;
+        while (m_head[bucket] == s_noVoice) {
+            ++bucket;
+        }
+        allocation.voice = static_cast<std::size_t>(m_head[bucket]);
+        allocation.stolen = true;
+
+        unlink(allocation.voice);
+        m_voiceOfNote[m_channelNote[allocation.voice]] = s_noVoice;
+    }
+
+    const std::uint16_t k = key(channel, note);
+    m_channelNote[allocation.voice] = k;
+    m_voiceOfNote[k] = static_cast<std::int16_t>(allocation.voice);
+    link(allocation.voice, s_nBuckets - 1);
+
+    return allocation;
+}
+
+void VoiceManager::setAmplitude(const std::size_t voice, const float amplitude)
+{
+    jassert(isSounding(voice));
+
+    const std::size_t bucket = bucketOf(amplitude);
+    if (bucket != m_bucket[voice]) {
+        unlink(voice);
+        link(voice, bucket);
+    }
+}
+
+void VoiceManager::retire(const std::size_t voice)
+{
+    if (!isSounding(voice)) {
+        return;
+    }
+
+    unlink(voice);
+    m_voiceOfNote[m_channelNote[voice]] = s_noVoice;
+    m_channelNote[voice] = s_free;
+
+    // swap with the first sounding voice, which becomes the top of the
+    // stack
+    const std::size_t position = m_position[voice];
+    const std::uint16_t first = m_order[m_nFree];
+    m_order[position] = first;
+    m_position[first] = static_cast<std::uint16_t>(position);
+    m_order[m_nFree] = static_cast<std::uint16_t>(voice);
+    m_position[voice] = static_cast<std::uint16_t>(m_nFree);
+    ++m_nFree;
+}
+
+std::size_t VoiceManager::bucketOf(const float amplitude)
+{
+    const int bucket = impl::halfOctaves(amplitude) - impl::floorHalfOctaves;
+    return static_cast<std::size_t>(
+        std::clamp(bucket, 0, static_cast<int>(s_nBuckets) - 1));
+}
+
+// at the tail, the head of a bucket is the voice that has been in it the
+// longest
+void VoiceManager::link(const std::size_t voice, const std::size_t bucket)
+{
+    const int v = static_cast<int>(voice);
+    const int tail = m_tail[bucket];
+
+    m_bucket[voice] = static_cast<std::uint8_t>(bucket);
+    m_prev[voice] = tail;
+    m_next[voice] = s_noVoice;
+    if (tail == s_noVoice) {
+        m_head[bucket] = v;
+    } else {
+        m_next[static_cast<std::size_t>(tail)] = v;
+    }
+    m_tail[bucket] = v;
+}
+
+void VoiceManager::unlink(const std::size_t voice)
+{
+    const std::size_t bucket = m_bucket[voice];
+    const int prev = m_prev[voice];
+    const int next = m_next[voice];
+
+    if (prev == s_noVoice) {
+        m_head[bucket] = next;
+    } else {
+        m_next[static_cast<std::size_t>(prev)] = next;
+    }
+    if (next == s_noVoice) {
+        m_tail[bucket] = prev;
+    } else {
+        m_prev[static_cast<std::size_t>(next)] = prev;
+    }
+}
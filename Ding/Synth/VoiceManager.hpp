@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// which voice plays which note, for DingSynth
+//
+// voices are plain indices, the manager never touches them: the synth asks
+// it where a note goes, tells it how loud every voice is after rendering and
+// when one has gone silent
+//
+// everything is O(1) per event whatever the polyphony:
+// - free voices are a stack, the sounding ones are packed right after it so
+//   the synth only ever loops over the voices that make sound
+// - a (channel, note) -> voice map finds the voice to strike again or to
+//   release, there is never more than one voice per note of a channel
+// - sounding voices sit in buckets of 3dB of amplitude, intrusive doubly
+//   linked lists, stealing takes the head of the quietest non empty bucket
+//   and there is a fixed number of buckets
+// a voice only moves between buckets when its amplitude crosses a bucket
+// boundary, a ringing note does that every few hundred ms
+//
+// nothing allocates outside of prepare, nothing locks, it belongs to the
+// audio thread
+class VoiceManager {
+   public:
+    static constexpr int s_noVoice = -1;
+
+    struct Allocation {
+        std::size_t voice;
+        // the voice was sounding another note, that note is gone
+        bool stolen;
+    };
+
+    // off the audio thread, every voice free
+    void prepare(std::size_t nVoices);
+
+    std::size_t size() const { return m_channelNote.size(); }
+
+    // voice sounding that note, or s_noVoice
+    int voiceFor(int channel, int note) const;
+
+    // a voice for a note that isn't sounding, a free one if any, otherwise
+    // the least audible one
+    // the new note counts as full scale until its first setAmplitude
+    Allocation allocate(int channel, int note);
+
+    // upper bound of the output of a sounding voice, as of the last render
+    void setAmplitude(std::size_t voice, float amplitude);
+
+    // the voice is silent, back to the free stack
+    void retire(std::size_t voice);
+
+    bool isSounding(std::size_t voice) const
+    {
+        return m_channelNote[voice] != s_free;
+    }
+    // channel of the note of a sounding voice
+    int channel(std::size_t voice) const
+    {
+        return 1 + m_channelNote[voice] / 128;
+    }
+
+    std::size_t nSounding() const { return size() - m_nFree; }
+    // the nSounding() sounding voices, until the next allocate or retire
+    const std::uint16_t* sounding() const { return m_order.data() + m_nFree; }
+
+    // f(voice) for every sounding voice, in no particular order
+    // f may retire the voice it is given, not any other
+    template <typename F>
+    void forEachSounding(F&& f)
+    {
+        // retiring swaps the voice with the first sounding one, which has
+        // already been visited
+        for (std::size_t i = m_nFree; i < m_order.size(); ++i) {
+            f(static_cast<std::size_t>(m_order[i]));
+        }
+    }
+
+   private:
+    // 2 buckets per octave from the silence threshold of Voice up to full
+    // scale, anything louder is in the last one
+    static constexpr int s_nOctaves = 10;
+    static constexpr std::size_t s_nBuckets = 2 * s_nOctaves + 1;
+    static std::size_t bucketOf(float amplitude);
+
+    static constexpr std::uint16_t s_free = 0xffff;
+    static std::uint16_t key(int channel, int note)
+    {
+        return static_cast<std::uint16_t>((channel - 1) * 128 + note);
+    }
+
+    void link(std::size_t voice, std::size_t bucket);
+    void unlink(std::size_t voice);
+
+    // the free stack, its top at m_nFree - 1, then the sounding voices
+    std::vector<std::uint16_t> m_order;
+    std::size_t m_nFree = 0;
+    // [voice] -> index in m_order
+    std::vector<std::uint16_t> m_position;
+
+    // [key(channel, note)] -> voice or s_noVoice
+    std::array<std::int16_t, 16 * 128> m_voiceOfNote{};
+    // [voice] -> key or s_free
+    std::vector<std::uint16_t> m_channelNote;
+
+    std::array<int, s_nBuckets> m_head{};
+    std::array<int, s_nBuckets> m_tail{};
+    std::vector<int> m_prev;
+    std::vector<int> m_next;
+    std::vector<std::uint8_t> m_bucket;
+};
@@ -0,0 +1,238 @@
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#include <juce_core/juce_core.h>
+
+#if JUCE_INTEL
+#include <immintrin.h>
+#endif
+
+#if JUCE_LINUX || JUCE_ANDROID
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif JUCE_WINDOWS
+#include <windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#endif
+
+namespace {
+namespace impl {
+// a worker spins this long for the next run before going to sleep, tens to
+// a couple hundred us depending on what a pause costs on the cpu, about the
+// gap between two blocks of a loaded stream
+static constexpr int spinIterations = 1 << 12;
+
+static void pause()
+{
+#if JUCE_INTEL
+    _mm_pause();
+#elif JUCE_ARM && (JUCE_GCC || JUCE_CLANG)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// sleeps while word == value, may wake up for nothing
+static void wait(std::atomic<std::uint32_t>& word, const std::uint32_t value)
+{
+#if JUCE_LINUX || JUCE_ANDROID
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#elif JUCE_WINDOWS
+    std::uint32_t expected = value;
+    WaitOnAddress(&word, &expected, sizeof(expected), INFINITE);
+#else
+    // no futex to wait on, a late worker only means the audio thread does
+    // more of the run itself
+    (void)word;
+    (void)value;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+#endif
+}
+
+static void wakeAll(std::atomic<std::uint32_t>& word)
+{
+#if JUCE_LINUX || JUCE_ANDROID
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#elif JUCE_WINDOWS
+    WakeByAddressAll(&word);
+#else
+    (void)word;
+#endif
+}
+
+static std::uint32_t generation(const std::uint64_t ticket)
+{
+    return static_cast<std::uint32_t>(ticket >> 32);
+}
+static std::size_t jobCount(const std::uint64_t ticket)
+{
+    return static_cast<std::size_t>((ticket >> 16) & 0xffff);
+}
+static std::size_t nextJob(const std::uint64_t ticket)
+{
+    return static_cast<std::size_t>(ticket & 0xffff);
+}
+}  // namespace impl
+}  // namespace
+
+class WorkerPool::Worker final : public juce::Thread {
+   public:
+    Worker(WorkerPool& pool, const std::size_t thread)
+        : juce::Thread("Ding render " + juce::String(thread)),
+          m_pool(pool),
+          m_thread(thread)
+    {
+    }
+
+    void run() override
+    {
+        // core 0 is left to the audio thread
+        const int nCores = juce::SystemStats::getNumCpus();
+        const auto core = static_cast<int>(m_thread) % std::max(nCores, 1);
+        if (core < 32) {
+            setCurrentThreadAffinityMask(1u << core);
+        }
+        m_pool.workerLoop(m_thread);
+    }
+
+   private:
+    WorkerPool& m_pool;
+    const std::size_t m_thread;
+};
+
+WorkerPool::WorkerPool() = default;
+
+WorkerPool::~WorkerPool()
+{
+    stopWorkers();
+}
+
+void WorkerPool::prepare(const std::size_t nThreads, const double blockMs)
+{
+    jassert(nThreads >= 1 && nThreads <= s_maxThreads);
+
+    stopWorkers();
+    m_quit.store(false);
+
+    for (std::size_t thread = 1; thread < nThreads; ++thread) {
+        m_workers.push_back(std::make_unique<Worker>(*this, thread));
+        Worker& worker = *m_workers.back();
+
+        // not every platform lets a plugin have realtime threads
+        if (!worker.startRealtimeThread(
+                juce::Thread::RealtimeOptions{}.withPeriodMs(blockMs))) {
+            worker.startThread(juce::Thread::Priority::highest);
+        }
+    }
+}
+
+void WorkerPool::stopWorkers()
+{
+    m_quit.store(true);
+    m_wake.fetch_add(1);
+    impl::wakeAll(m_wake);
+
+    for (const auto& worker : m_workers) {
+        worker->stopThread(1000);
+    }
+    m_workers.clear();
+}
+
+void WorkerPool::runJobs(const std::size_t nJobs,
+                         const JobFunction function,
+                         void* const context)
+{
+    jassert(nJobs <= 0xffff);
+
+    if (m_workers.empty() || nJobs <= 1) {
+        for (std::size_t i = 0; i < nJobs; ++i) {
+            function(context, i, 0);
+        }
+        return;
+    }
+
+    // every job of the previous run is done, nobody touches these
+    m_function.store(function, std::memory_order_relaxed);
+    m_context.store(context, std::memory_order_relaxed);
+    m_done.store(0, std::memory_order_relaxed);
+
+    const std::uint64_t generation =
+        impl::generation(m_ticket.load(std::memory_order_relaxed)) + 1u;
+    m_ticket.store((generation << 32) | (std::uint64_t{nJobs} << 16));
+
+    // seq_cst with the sleepers count, a worker either sees the new ticket
+    // before going to sleep or gets woken up
+    m_wake.fetch_add(1);
+    if (m_sleepers.load() > 0) {
+        impl::wakeAll(m_wake);
+    }
+
+    work(0);
+
+    // the barrier: the last jobs may still be running on the workers
+    // past the spin budget the worker holding them has been preempted,
+    // give it the core
+    for (int i = 0; m_done.load(std::memory_order_acquire) < nJobs; ++i) {
+        if (i < impl::spinIterations) {
+            impl::pause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WorkerPool::work(const std::size_t thread)
+{
+    std::uint64_t ticket = m_ticket.load(std::memory_order_acquire);
+    while (impl::nextJob(ticket) < impl::jobCount(ticket)) {
+        if (!m_ticket.compare_exchange_weak(ticket, ticket + 1,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+            continue;
+        }
+
+        // the run can't be over before this job is done, so these are
+        // still the ones of the ticket
+        const JobFunction function =
+            m_function.load(std::memory_order_relaxed);
+        function(m_context.load(std::memory_order_relaxed),
+                 impl::nextJob(ticket), thread);
+        m_done.fetch_add(1, std::memory_order_release);
+
+        ticket = m_ticket.load(std::memory_order_acquire);
+    }
+}
+
+void WorkerPool::workerLoop(const std::size_t thread)
+{
+    std::uint32_t seen = impl::generation(m_ticket.load());
+
+    while (!m_quit.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < impl::spinIterations; ++i) {
+            if (impl::generation(m_ticket.load(std::memory_order_relaxed)) !=
+                seen) {
+                break;
+            }
+            impl::pause();
+        }
+
+        if (impl::generation(m_ticket.load()) == seen) {
+            m_sleepers.fetch_add(1);
+            const std::uint32_t wake = m_wake.load();
+            if (impl::generation(m_ticket.load()) == seen && !m_quit.load()) {
+                impl::wait(m_wake, wake);
+            }
+            m_sleepers.fetch_sub(1);
+            continue;
+        }
+
+        seen = impl::generation(m_ticket.load(std::memory_order_acquire));
+        work(thread);
+    }
+}
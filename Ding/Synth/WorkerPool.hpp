@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// a few threads that help the audio thread render, for DingSynth
+//
+// the audio thread hands out a run of jobs and works on them too, the
+// workers grab the next job off an atomic counter until there is none left,
+// then the audio thread spins until the last one is done
+// no lock, no allocation, no queue: a run is one atomic ticket
+// (generation, number of jobs, next job), a worker can only claim a job of
+// the run that is current when it claims it, however late it wakes up
+//
+// between runs the workers spin for a while, then sleep on a futex, so a
+// busy stream keeps them hot and a stopped one doesn't burn the cpu
+// every worker is a realtime thread pinned to its own core
+class WorkerPool {
+   public:
+    static constexpr std::size_t s_maxThreads = 16;
+
+    WorkerPool();
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // nThreads counts the audio thread, 1 is no worker at all
+    // more threads than cores only makes them fight over the cores while
+    // they spin, the caller should know better
+    // blockMs is the period of the audio callback, a hint for the scheduler
+    // stops the previous workers, call it off the audio thread and never
+    // during a run
+    void prepare(std::size_t nThreads, double blockMs);
+
+    // the audio thread and the workers
+    std::size_t size() const { return m_workers.size() + 1; }
+
+    // job(index, thread) for every index in [0, nJobs), thread is in
+    // [0, size()), the audio thread is 0
+    // returns once every job is done
+    template <typename Job>
+    void run(std::size_t nJobs, Job& job)
+    {
+        runJobs(nJobs, &invoke<Job>, &job);
+    }
+
+   private:
+    class Worker;
+    using JobFunction = void (*)(void*, std::size_t, std::size_t);
+
+    template <typename Job>
+    static void invoke(void* job,
+                       const std::size_t index,
+                       const std::size_t thread)
+    {
+        (*static_cast<Job*>(job))(index, thread);
+    }
+
+    void runJobs(std::size_t nJobs, JobFunction function, void* context);
+    // claims and runs jobs of the current run until there are none left
+    void work(std::size_t thread);
+    void workerLoop(std::size_t thread);
+    void stopWorkers();
+
+    static constexpr std::size_t s_cacheLine = 64;
+
+    // generation << 32 | nJobs << 16 | next job
+    alignas(s_cacheLine) std::atomic<std::uint64_t> m_ticket{0};
+    alignas(s_cacheLine) std::atomic<std::size_t> m_done{0};
+    // futex word, bumped for every run, and how many workers sleep on it
+    alignas(s_cacheLine) std::atomic<std::uint32_t> m_wake{0};
+    std::atomic<std::uint32_t> m_sleepers{0};
+    std::atomic<bool> m_quit{false};
+
+    // of the current run, only read by a worker that holds its ticket
+    std::atomic<JobFunction> m_function{nullptr};
+    std::atomic<void*> m_context{nullptr};
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+// the bits of <cmath> needed to fill tables at compile time, std::exp & co
+// are not constexpr before C++26
+//
+// double all the way, these only ever run in the compiler
+namespace ConstexprMath {
+
+static constexpr double s_ln2 = 0.693147180559945309417;
+static constexpr double s_ln10 = 2.302585092994045684018;
+static constexpr double s_pi = 3.141592653589793238463;
+
+// e^x as 2^k e^r with |r| <= ln2 / 2, the series of e^r is down to the
+// double epsilon after ~20 terms
+constexpr double exp(const double x)
+{
+    const double kReal = x / s_ln2;
+    const long long k =
+        static_cast<long long>(kReal < 0.0 ? kReal - 0.5 : kReal + 0.5);
+    const double r = x - static_cast<double>(k) * s_ln2;
+
+    double sum = 1.0;
+    double term = 1.0;
+    for (int n = 1; n < 24; ++n) {
+        term *= r / static_cast<double>(n);
+        sum += term;
+    }
+
+    double scale = 1.0;
+    for (long long i = 0; i < k; ++i) {
+        scale *= 2.0;
+    }
+    for (long long i = 0; i > k; --i) {
+        scale *= 0.5;
+    }
+    return sum * scale;
+}
+
+// 10^(db / 20)
+constexpr double dbToGain(const double db)
+{
+    return exp(db * s_ln10 / 20.0);
+}
+
+constexpr double exp2(const double x)
+{
+    return exp(x * s_ln2);
+}
+
+// ln x for x > 0 as k ln2 + ln m with m in [1, 2)
+// ln m = 2 atanh(z), z = (m - 1) / (m + 1) <= 1/3, the odd series of atanh
+// is down to the double epsilon after ~20 terms
+constexpr double log(const double x)
+{
+    double m = x;
+    int k = 0;
+    while (m >= 2.0) {
+        m *= 0.5;
+        ++k;
+    }
+    while (m < 1.0) {
+        m *= 2.0;
+        --k;
+    }
+
+    const double z = (m - 1.0) / (m + 1.0);
+    const double z2 = z * z;
+    double sum = 0.0;
+    double power = z;
+    for (int n = 1; n < 48; n += 2) {
+        sum += power / static_cast<double>(n);
+        power *= z2;
+    }
+    return 2.0 * sum + static_cast<double>(k) * s_ln2;
+}
+
+constexpr double log2(const double x)
+{
+    return log(x) / s_ln2;
+}
+
+// cos x with x brought back to [-pi, pi], the series is down to the double
+// epsilon after ~15 terms
+constexpr double cos(const double x)
+{
+    const double turns = x / (2.0 * s_pi);
+    const long long k =
+        static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5);
+    const double r = x - static_cast<double>(k) * 2.0 * s_pi;
+    const double r2 = r * r;
+
+    double sum = 1.0;
+    double term = 1.0;
+    for (int n = 2; n < 48; n += 2) {
+        term *= -r2 / static_cast<double>((n - 1) * n);
+        sum += term;
+    }
+    return sum;
+}
+
+}  // namespace ConstexprMath
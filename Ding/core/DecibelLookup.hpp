@@ -1,22 +1,145 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 
-class DecibelLookup {
+#include <juce_dsp/juce_dsp.h>
+
+#include "ConstexprMath.hpp"
+
+// dB to linear gain, linear interpolation over a table built at compile time
+//
+// below MinDb is silence, above MaxDb is the gain at MaxDb
+// the range is in whole dB, C++17 has no float template parameters
+template <int MinDb, int MaxDb, std::size_t DataSize>
+class BasicDecibelLookup {
+    static_assert(MinDb < MaxDb);
+    static_assert(DataSize >= 2);
+
    public:
-    static float fromDb(float db);
+    static float fromDb(float db)
+    {
+        if (db < minDb) {
+            return 0.0f;
+        } else if (db >= maxDb) {
+            return data[dataSize - 1];
+        }
+
+        const float floatIndex = (db - minDb) * invStep;
+
+        const std::size_t i = static_cast<std::size_t>(floatIndex);
+        const float frac = floatIndex - static_cast<float>(i);
+
+        // i is safe bc of the early checks
+        return data[i] + frac * (data[i + 1] - data[i]);
+    }
+
+    // out[i] = fromDb(in[i]), a register of values at a time
+    //
+    // clamping and interpolation are branchless vector ops, only the table
+    // reads are scalar, there's no gather in SIMDRegister
+    // it goes in chunks of s_chunkSize values, one pass per step, so no
+    // register ever waits on a lane written just before
+    // no alignment requirement, in and out may be the same
+    static void fromDb(const float* in, float* out, std::size_t n)
+    {
+        using Register = juce::dsp::SIMDRegister<float>;
+        constexpr std::size_t laneWidth = Register::size();
+        static_assert(s_chunkSize % laneWidth == 0);
+
+        const Register lo(minDb);
+        const Register hi(maxDb);
+        const Register scale(invStep);
+        const Register one(1.0f);
+
+        alignas(64) std::array<float, s_chunkSize> index;
+        alignas(64) std::array<float, s_chunkSize> gate;
+        alignas(64) std::array<float, s_chunkSize> below;
+        alignas(64) std::array<float, s_chunkSize> above;
+
+        for (std::size_t start = 0; start < n; start += s_chunkSize) {
+            const std::size_t count = std::min(s_chunkSize, n - start);
+            const std::size_t padded =
+                (count + laneWidth - 1) / laneWidth * laneWidth;
+            std::copy_n(in + start, count, index.data());
+            std::fill(index.data() + count, index.data() + padded, minDb);
+
+            // below range is silence, above range is the last entry
+            for (std::size_t j = 0; j < padded; j += laneWidth) {
+                const Register db = Register::fromRawArray(&index[j]);
+                const Register audible =
+                    one & Register::greaterThanOrEqual(db, lo);
+                const Register floatIndex =
+                    (Register::max(Register::min(db, hi), lo) - lo) * scale;
+                audible.copyToRawArray(&gate[j]);
+                floatIndex.copyToRawArray(&index[j]);
+            }
+
+            // at maxDb the index is the last entry, interpolate from the one
+            // before with frac = 1
+            // int, a float to size_t conversion is a branch on x86
+            for (std::size_t j = 0; j < padded; ++j) {
+                const int i = std::min(static_cast<int>(index[j]), lastStart);
+                index[j] -= static_cast<float>(i);
+                below[j] = data[static_cast<std::size_t>(i)];
+                above[j] = data[static_cast<std::size_t>(i) + 1];
+            }
+
+            for (std::size_t j = 0; j < padded; j += laneWidth) {
+                const Register a = Register::fromRawArray(&below[j]);
+                const Register b = Register::fromRawArray(&above[j]);
+                const Register frac = Register::fromRawArray(&index[j]);
+                const Register gain =
+                    Register::multiplyAdd(a, frac, b - a) *
+                    Register::fromRawArray(&gate[j]);
+                gain.copyToRawArray(&index[j]);
+            }
+
+            std::copy_n(index.data(), count, out + start);
+        }
+    }
 
    private:
-    static constexpr float minDb = -96.0f;
-    static constexpr float maxDb = 12.0f;
-    static constexpr std::size_t dataSize = 2048;  // 2 pages
+    static constexpr std::size_t s_chunkSize = 64;
+
+    static constexpr float minDb = static_cast<float>(MinDb);
+    static constexpr float maxDb = static_cast<float>(MaxDb);
+    static constexpr std::size_t dataSize = DataSize;
+    // last entry an interpolation can start from
+    static constexpr int lastStart = static_cast<int>(dataSize) - 2;
     static constexpr float step =
-        (DecibelLookup::maxDb - DecibelLookup::minDb) /
-        static_cast<float>(DecibelLookup::dataSize - 1);
+        (maxDb - minDb) / static_cast<float>(dataSize - 1);
 
     // cached to avoid float division
-    static constexpr float invStep = 1.0f / DecibelLookup::step;
+    static constexpr float invStep = 1.0f / step;
 
-    alignas(4096) static const std::array<float, dataSize> data;
+    // one exp for the first entry and one for the ratio between entries,
+    // then a product: its rounding stays around 1e-13, way below float
+    static constexpr std::array<float, DataSize> tabulate()
+    {
+        const double dbStep =
+            static_cast<double>(MaxDb - MinDb) /
+            static_cast<double>(dataSize - 1);
+        const double ratio = ConstexprMath::dbToGain(dbStep);
+
+        std::array<float, DataSize> table{};
+        double gain = ConstexprMath::dbToGain(static_cast<double>(MinDb));
+        for (std::size_t i = 0; i < dataSize; ++i) {
+            table[i] = static_cast<float>(gain);
+            gain *= ratio;
+        }
+        return table;
+    }
+
+    // constant initialized from tabulate(), no code runs at load time
+    alignas(4096) static const std::array<float, DataSize> data;
 };
+
+template <int MinDb, int MaxDb, std::size_t DataSize>
+alignas(4096) const std::array<float, DataSize>
+    BasicDecibelLookup<MinDb, MaxDb, DataSize>::data =
+        BasicDecibelLookup<MinDb, MaxDb, DataSize>::tabulate();
+
+// -96dB to +12dB, 2048 entries (2 pages)
+using DecibelLookup = BasicDecibelLookup<-96, 12, 2048>;
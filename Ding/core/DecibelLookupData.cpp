@@ -1,2052 +0,0 @@
-#include "DecibelLookup.hpp"
-
-constexpr std::array<float, 2048> DecibelLookup::data = {
-    1.58489319e-05f,  //  -96.00 dB
-    1.59454950e-05f,  //  -95.95 dB
-    1.60426465e-05f,  //  -95.89 dB
-    1.61403899e-05f,  //  -95.84 dB
-    1.62387287e-05f,  //  -95.79 dB
-    1.63376668e-05f,  //  -95.74 dB
-    1.64372076e-05f,  //  -95.68 dB
-    1.65373549e-05f,  //  -95.63 dB
-    1.66381124e-05f,  //  -95.58 dB
-    1.67394838e-05f,  //  -95.53 dB
-    1.68414728e-05f,  //  -95.47 dB
-    1.69440832e-05f,  //  -95.42 dB
-    1.70473188e-05f,  //  -95.37 dB
-    1.71511833e-05f,  //  -95.31 dB
-    1.72556807e-05f,  //  -95.26 dB
-    1.73608147e-05f,  //  -95.21 dB
-    1.74665893e-05f,  //  -95.16 dB
-    1.75730084e-05f,  //  -95.10 dB
-    1.76800758e-05f,  //  -95.05 dB
-    1.77877956e-05f,  //  -95.00 dB
-    1.78961717e-05f,  //  -94.94 dB
-    1.80052080e-05f,  //  -94.89 dB
-    1.81149087e-05f,  //  -94.84 dB
-    1.82252778e-05f,  //  -94.79 dB
-    1.83363194e-05f,  //  -94.73 dB
-    1.84480374e-05f,  //  -94.68 dB
-    1.85604362e-05f,  //  -94.63 dB
-    1.86735197e-05f,  //  -94.58 dB
-    1.87872923e-05f,  //  -94.52 dB
-    1.89017580e-05f,  //  -94.47 dB
-    1.90169211e-05f,  //  -94.42 dB
-    1.91327859e-05f,  //  -94.36 dB
-    1.92493566e-05f,  //  -94.31 dB
-    1.93666376e-05f,  //  -94.26 dB
-    1.94846331e-05f,  //  -94.21 dB
-    1.96033475e-05f,  //  -94.15 dB
-    1.97227853e-05f,  //  -94.10 dB
-    1.98429507e-05f,  //  -94.05 dB
-    1.99638482e-05f,  //  -94.00 dB
-    2.00854824e-05f,  //  -93.94 dB
-    2.02078576e-05f,  //  -93.89 dB
-    2.03309785e-05f,  //  -93.84 dB
-    2.04548494e-05f,  //  -93.78 dB
-    2.05794751e-05f,  //  -93.73 dB
-    2.07048601e-05f,  //  -93.68 dB
-    2.08310091e-05f,  //  -93.63 dB
-    2.09579266e-05f,  //  -93.57 dB
-    2.10856174e-05f,  //  -93.52 dB
-    2.12140862e-05f,  //  -93.47 dB
-    2.13433377e-05f,  //  -93.41 dB
-    2.14733767e-05f,  //  -93.36 dB
-    2.16042079e-05f,  //  -93.31 dB
-    2.17358364e-05f,  //  -93.26 dB
-    2.18682667e-05f,  //  -93.20 dB
-    2.20015040e-05f,  //  -93.15 dB
-    2.21355530e-05f,  //  -93.10 dB
-    2.22704187e-05f,  //  -93.05 dB
-    2.24061062e-05f,  //  -92.99 dB
-    2.25426203e-05f,  //  -92.94 dB
-    2.26799662e-05f,  //  -92.89 dB
-    2.28181489e-05f,  //  -92.83 dB
-    2.29571735e-05f,  //  -92.78 dB
-    2.30970452e-05f,  //  -92.73 dB
-    2.32377690e-05f,  //  -92.68 dB
-    2.33793503e-05f,  //  -92.62 dB
-    2.35217941e-05f,  //  -92.57 dB
-    2.36651059e-05f,  //  -92.52 dB
-    2.38092907e-05f,  //  -92.47 dB
-    2.39543541e-05f,  //  -92.41 dB
-    2.41003013e-05f,  //  -92.36 dB
-    2.42471377e-05f,  //  -92.31 dB
-    2.43948687e-05f,  //  -92.25 dB
-    2.45434999e-05f,  //  -92.20 dB
-    2.46930366e-05f,  //  -92.15 dB
-    2.48434843e-05f,  //  -92.10 dB
-    2.49948487e-05f,  //  -92.04 dB
-    2.51471354e-05f,  //  -91.99 dB
-    2.53003499e-05f,  //  -91.94 dB
-    2.54544978e-05f,  //  -91.88 dB
-    2.56095850e-05f,  //  -91.83 dB
-    2.57656170e-05f,  //  -91.78 dB
-    2.59225997e-05f,  //  -91.73 dB
-    2.60805389e-05f,  //  -91.67 dB
-    2.62394403e-05f,  //  -91.62 dB
-    2.63993099e-05f,  //  -91.57 dB
-    2.65601535e-05f,  //  -91.52 dB
-    2.67219771e-05f,  //  -91.46 dB
-    2.68847867e-05f,  //  -91.41 dB
-    2.70485882e-05f,  //  -91.36 dB
-    2.72133877e-05f,  //  -91.30 dB
-    2.73791913e-05f,  //  -91.25 dB
-    2.75460050e-05f,  //  -91.20 dB
-    2.77138351e-05f,  //  -91.15 dB
-    2.78826878e-05f,  //  -91.09 dB
-    2.80525692e-05f,  //  -91.04 dB
-    2.82234857e-05f,  //  -90.99 dB
-    2.83954435e-05f,  //  -90.94 dB
-    2.85684490e-05f,  //  -90.88 dB
-    2.87425086e-05f,  //  -90.83 dB
-    2.89176287e-05f,  //  -90.78 dB
-    2.90938157e-05f,  //  -90.72 dB
-    2.92710762e-05f,  //  -90.67 dB
-    2.94494167e-05f,  //  -90.62 dB
-    2.96288438e-05f,  //  -90.57 dB
-    2.98093641e-05f,  //  -90.51 dB
-    2.99909842e-05f,  //  -90.46 dB
-    3.01737109e-05f,  //  -90.41 dB
-    3.03575509e-05f,  //  -90.35 dB
-    3.05425110e-05f,  //  -90.30 dB
-    3.07285980e-05f,  //  -90.25 dB
-    3.09158187e-05f,  //  -90.20 dB
-    3.11041802e-05f,  //  -90.14 dB
-    3.12936893e-05f,  //  -90.09 dB
-    3.14843530e-05f,  //  -90.04 dB
-    3.16761784e-05f,  //  -89.99 dB
-    3.18691725e-05f,  //  -89.93 dB
-    3.20633424e-05f,  //  -89.88 dB
-    3.22586954e-05f,  //  -89.83 dB
-    3.24552387e-05f,  //  -89.77 dB
-    3.26529794e-05f,  //  -89.72 dB
-    3.28519249e-05f,  //  -89.67 dB
-    3.30520825e-05f,  //  -89.62 dB
-    3.32534596e-05f,  //  -89.56 dB
-    3.34560636e-05f,  //  -89.51 dB
-    3.36599021e-05f,  //  -89.46 dB
-    3.38649825e-05f,  //  -89.40 dB
-    3.40713123e-05f,  //  -89.35 dB
-    3.42788993e-05f,  //  -89.30 dB
-    3.44877511e-05f,  //  -89.25 dB
-    3.46978753e-05f,  //  -89.19 dB
-    3.49092798e-05f,  //  -89.14 dB
-    3.51219723e-05f,  //  -89.09 dB
-    3.53359607e-05f,  //  -89.04 dB
-    3.55512528e-05f,  //  -88.98 dB
-    3.57678567e-05f,  //  -88.93 dB
-    3.59857802e-05f,  //  -88.88 dB
-    3.62050315e-05f,  //  -88.82 dB
-    3.64256187e-05f,  //  -88.77 dB
-    3.66475498e-05f,  //  -88.72 dB
-    3.68708331e-05f,  //  -88.67 dB
-    3.70954768e-05f,  //  -88.61 dB
-    3.73214892e-05f,  //  -88.56 dB
-    3.75488786e-05f,  //  -88.51 dB
-    3.77776534e-05f,  //  -88.46 dB
-    3.80078221e-05f,  //  -88.40 dB
-    3.82393932e-05f,  //  -88.35 dB
-    3.84723751e-05f,  //  -88.30 dB
-    3.87067766e-05f,  //  -88.24 dB
-    3.89426061e-05f,  //  -88.19 dB
-    3.91798726e-05f,  //  -88.14 dB
-    3.94185846e-05f,  //  -88.09 dB
-    3.96587510e-05f,  //  -88.03 dB
-    3.99003807e-05f,  //  -87.98 dB
-    4.01434826e-05f,  //  -87.93 dB
-    4.03880656e-05f,  //  -87.87 dB
-    4.06341388e-05f,  //  -87.82 dB
-    4.08817113e-05f,  //  -87.77 dB
-    4.11307921e-05f,  //  -87.72 dB
-    4.13813906e-05f,  //  -87.66 dB
-    4.16335158e-05f,  //  -87.61 dB
-    4.18871772e-05f,  //  -87.56 dB
-    4.21423841e-05f,  //  -87.51 dB
-    4.23991459e-05f,  //  -87.45 dB
-    4.26574720e-05f,  //  -87.40 dB
-    4.29173721e-05f,  //  -87.35 dB
-    4.31788557e-05f,  //  -87.29 dB
-    4.34419324e-05f,  //  -87.24 dB
-    4.37066120e-05f,  //  -87.19 dB
-    4.39729041e-05f,  //  -87.14 dB
-    4.42408188e-05f,  //  -87.08 dB
-    4.45103657e-05f,  //  -87.03 dB
-    4.47815550e-05f,  //  -86.98 dB
-    4.50543965e-05f,  //  -86.93 dB
-    4.53289003e-05f,  //  -86.87 dB
-    4.56050767e-05f,  //  -86.82 dB
-    4.58829357e-05f,  //  -86.77 dB
-    4.61624876e-05f,  //  -86.71 dB
-    4.64437427e-05f,  //  -86.66 dB
-    4.67267115e-05f,  //  -86.61 dB
-    4.70114043e-05f,  //  -86.56 dB
-    4.72978316e-05f,  //  -86.50 dB
-    4.75860041e-05f,  //  -86.45 dB
-    4.78759324e-05f,  //  -86.40 dB
-    4.81676271e-05f,  //  -86.34 dB
-    4.84610990e-05f,  //  -86.29 dB
-    4.87563589e-05f,  //  -86.24 dB
-    4.90534178e-05f,  //  -86.19 dB
-    4.93522866e-05f,  //  -86.13 dB
-    4.96529763e-05f,  //  -86.08 dB
-    4.99554980e-05f,  //  -86.03 dB
-    5.02598629e-05f,  //  -85.98 dB
-    5.05660822e-05f,  //  -85.92 dB
-    5.08741672e-05f,  //  -85.87 dB
-    5.11841293e-05f,  //  -85.82 dB
-    5.14959799e-05f,  //  -85.76 dB
-    5.18097306e-05f,  //  -85.71 dB
-    5.21253928e-05f,  //  -85.66 dB
-    5.24429782e-05f,  //  -85.61 dB
-    5.27624987e-05f,  //  -85.55 dB
-    5.30839658e-05f,  //  -85.50 dB
-    5.34073916e-05f,  //  -85.45 dB
-    5.37327879e-05f,  //  -85.40 dB
-    5.40601668e-05f,  //  -85.34 dB
-    5.43895403e-05f,  //  -85.29 dB
-    5.47209206e-05f,  //  -85.24 dB
-    5.50543199e-05f,  //  -85.18 dB
-    5.53897505e-05f,  //  -85.13 dB
-    5.57272248e-05f,  //  -85.08 dB
-    5.60667552e-05f,  //  -85.03 dB
-    5.64083543e-05f,  //  -84.97 dB
-    5.67520346e-05f,  //  -84.92 dB
-    5.70978089e-05f,  //  -84.87 dB
-    5.74456900e-05f,  //  -84.81 dB
-    5.77956905e-05f,  //  -84.76 dB
-    5.81478235e-05f,  //  -84.71 dB
-    5.85021020e-05f,  //  -84.66 dB
-    5.88585389e-05f,  //  -84.60 dB
-    5.92171476e-05f,  //  -84.55 dB
-    5.95779411e-05f,  //  -84.50 dB
-    5.99409329e-05f,  //  -84.45 dB
-    6.03061363e-05f,  //  -84.39 dB
-    6.06735647e-05f,  //  -84.34 dB
-    6.10432318e-05f,  //  -84.29 dB
-    6.14151512e-05f,  //  -84.23 dB
-    6.17893365e-05f,  //  -84.18 dB
-    6.21658017e-05f,  //  -84.13 dB
-    6.25445606e-05f,  //  -84.08 dB
-    6.29256271e-05f,  //  -84.02 dB
-    6.33090154e-05f,  //  -83.97 dB
-    6.36947396e-05f,  //  -83.92 dB
-    6.40828138e-05f,  //  -83.87 dB
-    6.44732525e-05f,  //  -83.81 dB
-    6.48660700e-05f,  //  -83.76 dB
-    6.52612809e-05f,  //  -83.71 dB
-    6.56588997e-05f,  //  -83.65 dB
-    6.60589410e-05f,  //  -83.60 dB
-    6.64614197e-05f,  //  -83.55 dB
-    6.68663506e-05f,  //  -83.50 dB
-    6.72737486e-05f,  //  -83.44 dB
-    6.76836287e-05f,  //  -83.39 dB
-    6.80960062e-05f,  //  -83.34 dB
-    6.85108961e-05f,  //  -83.28 dB
-    6.89283139e-05f,  //  -83.23 dB
-    6.93482749e-05f,  //  -83.18 dB
-    6.97707946e-05f,  //  -83.13 dB
-    7.01958885e-05f,  //  -83.07 dB
-    7.06235725e-05f,  //  -83.02 dB
-    7.10538622e-05f,  //  -82.97 dB
-    7.14867735e-05f,  //  -82.92 dB
-    7.19223225e-05f,  //  -82.86 dB
-    7.23605251e-05f,  //  -82.81 dB
-    7.28013976e-05f,  //  -82.76 dB
-    7.32449562e-05f,  //  -82.70 dB
-    7.36912172e-05f,  //  -82.65 dB
-    7.41401973e-05f,  //  -82.60 dB
-    7.45919128e-05f,  //  -82.55 dB
-    7.50463805e-05f,  //  -82.49 dB
-    7.55036171e-05f,  //  -82.44 dB
-    7.59636396e-05f,  //  -82.39 dB
-    7.64264648e-05f,  //  -82.34 dB
-    7.68921099e-05f,  //  -82.28 dB
-    7.73605921e-05f,  //  -82.23 dB
-    7.78319286e-05f,  //  -82.18 dB
-    7.83061368e-05f,  //  -82.12 dB
-    7.87832342e-05f,  //  -82.07 dB
-    7.92632385e-05f,  //  -82.02 dB
-    7.97461673e-05f,  //  -81.97 dB
-    8.02320384e-05f,  //  -81.91 dB
-    8.07208698e-05f,  //  -81.86 dB
-    8.12126795e-05f,  //  -81.81 dB
-    8.17074857e-05f,  //  -81.75 dB
-    8.22053066e-05f,  //  -81.70 dB
-    8.27061606e-05f,  //  -81.65 dB
-    8.32100661e-05f,  //  -81.60 dB
-    8.37170418e-05f,  //  -81.54 dB
-    8.42271064e-05f,  //  -81.49 dB
-    8.47402786e-05f,  //  -81.44 dB
-    8.52565775e-05f,  //  -81.39 dB
-    8.57760220e-05f,  //  -81.33 dB
-    8.62986314e-05f,  //  -81.28 dB
-    8.68244248e-05f,  //  -81.23 dB
-    8.73534218e-05f,  //  -81.17 dB
-    8.78856418e-05f,  //  -81.12 dB
-    8.84211045e-05f,  //  -81.07 dB
-    8.89598296e-05f,  //  -81.02 dB
-    8.95018370e-05f,  //  -80.96 dB
-    9.00471467e-05f,  //  -80.91 dB
-    9.05957788e-05f,  //  -80.86 dB
-    9.11477536e-05f,  //  -80.81 dB
-    9.17030914e-05f,  //  -80.75 dB
-    9.22618128e-05f,  //  -80.70 dB
-    9.28239382e-05f,  //  -80.65 dB
-    9.33894886e-05f,  //  -80.59 dB
-    9.39584846e-05f,  //  -80.54 dB
-    9.45309475e-05f,  //  -80.49 dB
-    9.51068981e-05f,  //  -80.44 dB
-    9.56863579e-05f,  //  -80.38 dB
-    9.62693482e-05f,  //  -80.33 dB
-    9.68558904e-05f,  //  -80.28 dB
-    9.74460063e-05f,  //  -80.22 dB
-    9.80397176e-05f,  //  -80.17 dB
-    9.86370463e-05f,  //  -80.12 dB
-    9.92380142e-05f,  //  -80.07 dB
-    9.98426438e-05f,  //  -80.01 dB
-    1.00450957e-04f,  //  -79.96 dB
-    1.01062977e-04f,  //  -79.91 dB
-    1.01678725e-04f,  //  -79.86 dB
-    1.02298225e-04f,  //  -79.80 dB
-    1.02921500e-04f,  //  -79.75 dB
-    1.03548572e-04f,  //  -79.70 dB
-    1.04179464e-04f,  //  -79.64 dB
-    1.04814201e-04f,  //  -79.59 dB
-    1.05452804e-04f,  //  -79.54 dB
-    1.06095299e-04f,  //  -79.49 dB
-    1.06741708e-04f,  //  -79.43 dB
-    1.07392055e-04f,  //  -79.38 dB
-    1.08046365e-04f,  //  -79.33 dB
-    1.08704662e-04f,  //  -79.28 dB
-    1.09366969e-04f,  //  -79.22 dB
-    1.10033311e-04f,  //  -79.17 dB
-    1.10703713e-04f,  //  -79.12 dB
-    1.11378200e-04f,  //  -79.06 dB
-    1.12056796e-04f,  //  -79.01 dB
-    1.12739527e-04f,  //  -78.96 dB
-    1.13426418e-04f,  //  -78.91 dB
-    1.14117493e-04f,  //  -78.85 dB
-    1.14812779e-04f,  //  -78.80 dB
-    1.15512301e-04f,  //  -78.75 dB
-    1.16216086e-04f,  //  -78.69 dB
-    1.16924158e-04f,  //  -78.64 dB
-    1.17636544e-04f,  //  -78.59 dB
-    1.18353271e-04f,  //  -78.54 dB
-    1.19074364e-04f,  //  -78.48 dB
-    1.19799851e-04f,  //  -78.43 dB
-    1.20529758e-04f,  //  -78.38 dB
-    1.21264112e-04f,  //  -78.33 dB
-    1.22002940e-04f,  //  -78.27 dB
-    1.22746270e-04f,  //  -78.22 dB
-    1.23494129e-04f,  //  -78.17 dB
-    1.24246544e-04f,  //  -78.11 dB
-    1.25003544e-04f,  //  -78.06 dB
-    1.25765156e-04f,  //  -78.01 dB
-    1.26531407e-04f,  //  -77.96 dB
-    1.27302328e-04f,  //  -77.90 dB
-    1.28077946e-04f,  //  -77.85 dB
-    1.28858289e-04f,  //  -77.80 dB
-    1.29643386e-04f,  //  -77.74 dB
-    1.30433267e-04f,  //  -77.69 dB
-    1.31227961e-04f,  //  -77.64 dB
-    1.32027496e-04f,  //  -77.59 dB
-    1.32831903e-04f,  //  -77.53 dB
-    1.33641210e-04f,  //  -77.48 dB
-    1.34455449e-04f,  //  -77.43 dB
-    1.35274649e-04f,  //  -77.38 dB
-    1.36098839e-04f,  //  -77.32 dB
-    1.36928051e-04f,  //  -77.27 dB
-    1.37762316e-04f,  //  -77.22 dB
-    1.38601663e-04f,  //  -77.16 dB
-    1.39446124e-04f,  //  -77.11 dB
-    1.40295731e-04f,  //  -77.06 dB
-    1.41150513e-04f,  //  -77.01 dB
-    1.42010504e-04f,  //  -76.95 dB
-    1.42875734e-04f,  //  -76.90 dB
-    1.43746236e-04f,  //  -76.85 dB
-    1.44622042e-04f,  //  -76.80 dB
-    1.45503184e-04f,  //  -76.74 dB
-    1.46389694e-04f,  //  -76.69 dB
-    1.47281606e-04f,  //  -76.64 dB
-    1.48178951e-04f,  //  -76.58 dB
-    1.49081764e-04f,  //  -76.53 dB
-    1.49990078e-04f,  //  -76.48 dB
-    1.50903926e-04f,  //  -76.43 dB
-    1.51823341e-04f,  //  -76.37 dB
-    1.52748358e-04f,  //  -76.32 dB
-    1.53679011e-04f,  //  -76.27 dB
-    1.54615335e-04f,  //  -76.21 dB
-    1.55557363e-04f,  //  -76.16 dB
-    1.56505130e-04f,  //  -76.11 dB
-    1.57458672e-04f,  //  -76.06 dB
-    1.58418024e-04f,  //  -76.00 dB
-    1.59383221e-04f,  //  -75.95 dB
-    1.60354298e-04f,  //  -75.90 dB
-    1.61331292e-04f,  //  -75.85 dB
-    1.62314239e-04f,  //  -75.79 dB
-    1.63303174e-04f,  //  -75.74 dB
-    1.64298135e-04f,  //  -75.69 dB
-    1.65299157e-04f,  //  -75.63 dB
-    1.66306279e-04f,  //  -75.58 dB
-    1.67319537e-04f,  //  -75.53 dB
-    1.68338968e-04f,  //  -75.48 dB
-    1.69364610e-04f,  //  -75.42 dB
-    1.70396502e-04f,  //  -75.37 dB
-    1.71434680e-04f,  //  -75.32 dB
-    1.72479184e-04f,  //  -75.27 dB
-    1.73530051e-04f,  //  -75.21 dB
-    1.74587321e-04f,  //  -75.16 dB
-    1.75651033e-04f,  //  -75.11 dB
-    1.76721226e-04f,  //  -75.05 dB
-    1.77797939e-04f,  //  -75.00 dB
-    1.78881212e-04f,  //  -74.95 dB
-    1.79971085e-04f,  //  -74.90 dB
-    1.81067599e-04f,  //  -74.84 dB
-    1.82170793e-04f,  //  -74.79 dB
-    1.83280709e-04f,  //  -74.74 dB
-    1.84397387e-04f,  //  -74.68 dB
-    1.85520869e-04f,  //  -74.63 dB
-    1.86651196e-04f,  //  -74.58 dB
-    1.87788409e-04f,  //  -74.53 dB
-    1.88932552e-04f,  //  -74.47 dB
-    1.90083665e-04f,  //  -74.42 dB
-    1.91241792e-04f,  //  -74.37 dB
-    1.92406975e-04f,  //  -74.32 dB
-    1.93579257e-04f,  //  -74.26 dB
-    1.94758681e-04f,  //  -74.21 dB
-    1.95945291e-04f,  //  -74.16 dB
-    1.97139131e-04f,  //  -74.10 dB
-    1.98340245e-04f,  //  -74.05 dB
-    1.99548677e-04f,  //  -74.00 dB
-    2.00764471e-04f,  //  -73.95 dB
-    2.01987673e-04f,  //  -73.89 dB
-    2.03218327e-04f,  //  -73.84 dB
-    2.04456480e-04f,  //  -73.79 dB
-    2.05702176e-04f,  //  -73.74 dB
-    2.06955462e-04f,  //  -73.68 dB
-    2.08216384e-04f,  //  -73.63 dB
-    2.09484988e-04f,  //  -73.58 dB
-    2.10761322e-04f,  //  -73.52 dB
-    2.12045432e-04f,  //  -73.47 dB
-    2.13337365e-04f,  //  -73.42 dB
-    2.14637170e-04f,  //  -73.37 dB
-    2.15944895e-04f,  //  -73.31 dB
-    2.17260587e-04f,  //  -73.26 dB
-    2.18584295e-04f,  //  -73.21 dB
-    2.19916068e-04f,  //  -73.15 dB
-    2.21255955e-04f,  //  -73.10 dB
-    2.22604006e-04f,  //  -73.05 dB
-    2.23960270e-04f,  //  -73.00 dB
-    2.25324797e-04f,  //  -72.94 dB
-    2.26697638e-04f,  //  -72.89 dB
-    2.28078844e-04f,  //  -72.84 dB
-    2.29468464e-04f,  //  -72.79 dB
-    2.30866552e-04f,  //  -72.73 dB
-    2.32273157e-04f,  //  -72.68 dB
-    2.33688333e-04f,  //  -72.63 dB
-    2.35112130e-04f,  //  -72.57 dB
-    2.36544603e-04f,  //  -72.52 dB
-    2.37985803e-04f,  //  -72.47 dB
-    2.39435784e-04f,  //  -72.42 dB
-    2.40894600e-04f,  //  -72.36 dB
-    2.42362303e-04f,  //  -72.31 dB
-    2.43838949e-04f,  //  -72.26 dB
-    2.45324592e-04f,  //  -72.21 dB
-    2.46819286e-04f,  //  -72.15 dB
-    2.48323087e-04f,  //  -72.10 dB
-    2.49836050e-04f,  //  -72.05 dB
-    2.51358231e-04f,  //  -71.99 dB
-    2.52889687e-04f,  //  -71.94 dB
-    2.54430473e-04f,  //  -71.89 dB
-    2.55980647e-04f,  //  -71.84 dB
-    2.57540266e-04f,  //  -71.78 dB
-    2.59109387e-04f,  //  -71.73 dB
-    2.60688068e-04f,  //  -71.68 dB
-    2.62276367e-04f,  //  -71.62 dB
-    2.63874344e-04f,  //  -71.57 dB
-    2.65482057e-04f,  //  -71.52 dB
-    2.67099565e-04f,  //  -71.47 dB
-    2.68726928e-04f,  //  -71.41 dB
-    2.70364206e-04f,  //  -71.36 dB
-    2.72011460e-04f,  //  -71.31 dB
-    2.73668749e-04f,  //  -71.26 dB
-    2.75336137e-04f,  //  -71.20 dB
-    2.77013683e-04f,  //  -71.15 dB
-    2.78701450e-04f,  //  -71.10 dB
-    2.80399500e-04f,  //  -71.04 dB
-    2.82107896e-04f,  //  -70.99 dB
-    2.83826701e-04f,  //  -70.94 dB
-    2.85555977e-04f,  //  -70.89 dB
-    2.87295790e-04f,  //  -70.83 dB
-    2.89046203e-04f,  //  -70.78 dB
-    2.90807281e-04f,  //  -70.73 dB
-    2.92579089e-04f,  //  -70.68 dB
-    2.94361691e-04f,  //  -70.62 dB
-    2.96155155e-04f,  //  -70.57 dB
-    2.97959546e-04f,  //  -70.52 dB
-    2.99774930e-04f,  //  -70.46 dB
-    3.01601375e-04f,  //  -70.41 dB
-    3.03438948e-04f,  //  -70.36 dB
-    3.05287717e-04f,  //  -70.31 dB
-    3.07147750e-04f,  //  -70.25 dB
-    3.09019115e-04f,  //  -70.20 dB
-    3.10901882e-04f,  //  -70.15 dB
-    3.12796121e-04f,  //  -70.09 dB
-    3.14701900e-04f,  //  -70.04 dB
-    3.16619291e-04f,  //  -69.99 dB
-    3.18548364e-04f,  //  -69.94 dB
-    3.20489190e-04f,  //  -69.88 dB
-    3.22441841e-04f,  //  -69.83 dB
-    3.24406389e-04f,  //  -69.78 dB
-    3.26382907e-04f,  //  -69.73 dB
-    3.28371467e-04f,  //  -69.67 dB
-    3.30372142e-04f,  //  -69.62 dB
-    3.32385008e-04f,  //  -69.57 dB
-    3.34410137e-04f,  //  -69.51 dB
-    3.36447604e-04f,  //  -69.46 dB
-    3.38497486e-04f,  //  -69.41 dB
-    3.40559856e-04f,  //  -69.36 dB
-    3.42634792e-04f,  //  -69.30 dB
-    3.44722370e-04f,  //  -69.25 dB
-    3.46822668e-04f,  //  -69.20 dB
-    3.48935761e-04f,  //  -69.15 dB
-    3.51061729e-04f,  //  -69.09 dB
-    3.53200651e-04f,  //  -69.04 dB
-    3.55352604e-04f,  //  -68.99 dB
-    3.57517668e-04f,  //  -68.93 dB
-    3.59695923e-04f,  //  -68.88 dB
-    3.61887450e-04f,  //  -68.83 dB
-    3.64092329e-04f,  //  -68.78 dB
-    3.66310642e-04f,  //  -68.72 dB
-    3.68542470e-04f,  //  -68.67 dB
-    3.70787897e-04f,  //  -68.62 dB
-    3.73047004e-04f,  //  -68.56 dB
-    3.75319875e-04f,  //  -68.51 dB
-    3.77606594e-04f,  //  -68.46 dB
-    3.79907246e-04f,  //  -68.41 dB
-    3.82221915e-04f,  //  -68.35 dB
-    3.84550686e-04f,  //  -68.30 dB
-    3.86893646e-04f,  //  -68.25 dB
-    3.89250881e-04f,  //  -68.20 dB
-    3.91622478e-04f,  //  -68.14 dB
-    3.94008524e-04f,  //  -68.09 dB
-    3.96409108e-04f,  //  -68.04 dB
-    3.98824318e-04f,  //  -67.98 dB
-    4.01254244e-04f,  //  -67.93 dB
-    4.03698974e-04f,  //  -67.88 dB
-    4.06158599e-04f,  //  -67.83 dB
-    4.08633210e-04f,  //  -67.77 dB
-    4.11122898e-04f,  //  -67.72 dB
-    4.13627755e-04f,  //  -67.67 dB
-    4.16147873e-04f,  //  -67.62 dB
-    4.18683346e-04f,  //  -67.56 dB
-    4.21234267e-04f,  //  -67.51 dB
-    4.23800730e-04f,  //  -67.46 dB
-    4.26382829e-04f,  //  -67.40 dB
-    4.28980661e-04f,  //  -67.35 dB
-    4.31594320e-04f,  //  -67.30 dB
-    4.34223904e-04f,  //  -67.25 dB
-    4.36869509e-04f,  //  -67.19 dB
-    4.39531233e-04f,  //  -67.14 dB
-    4.42209174e-04f,  //  -67.09 dB
-    4.44903431e-04f,  //  -67.03 dB
-    4.47614103e-04f,  //  -66.98 dB
-    4.50341291e-04f,  //  -66.93 dB
-    4.53085095e-04f,  //  -66.88 dB
-    4.55845616e-04f,  //  -66.82 dB
-    4.58622956e-04f,  //  -66.77 dB
-    4.61417217e-04f,  //  -66.72 dB
-    4.64228504e-04f,  //  -66.67 dB
-    4.67056918e-04f,  //  -66.61 dB
-    4.69902566e-04f,  //  -66.56 dB
-    4.72765551e-04f,  //  -66.51 dB
-    4.75645979e-04f,  //  -66.45 dB
-    4.78543958e-04f,  //  -66.40 dB
-    4.81459592e-04f,  //  -66.35 dB
-    4.84392991e-04f,  //  -66.30 dB
-    4.87344262e-04f,  //  -66.24 dB
-    4.90313515e-04f,  //  -66.19 dB
-    4.93300858e-04f,  //  -66.14 dB
-    4.96306403e-04f,  //  -66.09 dB
-    4.99330259e-04f,  //  -66.03 dB
-    5.02372539e-04f,  //  -65.98 dB
-    5.05433354e-04f,  //  -65.93 dB
-    5.08512819e-04f,  //  -65.87 dB
-    5.11611045e-04f,  //  -65.82 dB
-    5.14728149e-04f,  //  -65.77 dB
-    5.17864244e-04f,  //  -65.72 dB
-    5.21019446e-04f,  //  -65.66 dB
-    5.24193872e-04f,  //  -65.61 dB
-    5.27387639e-04f,  //  -65.56 dB
-    5.30600864e-04f,  //  -65.50 dB
-    5.33833667e-04f,  //  -65.45 dB
-    5.37086167e-04f,  //  -65.40 dB
-    5.40358483e-04f,  //  -65.35 dB
-    5.43650736e-04f,  //  -65.29 dB
-    5.46963048e-04f,  //  -65.24 dB
-    5.50295541e-04f,  //  -65.19 dB
-    5.53648339e-04f,  //  -65.14 dB
-    5.57021563e-04f,  //  -65.08 dB
-    5.60415340e-04f,  //  -65.03 dB
-    5.63829794e-04f,  //  -64.98 dB
-    5.67265052e-04f,  //  -64.92 dB
-    5.70721239e-04f,  //  -64.87 dB
-    5.74198485e-04f,  //  -64.82 dB
-    5.77696916e-04f,  //  -64.77 dB
-    5.81216662e-04f,  //  -64.71 dB
-    5.84757853e-04f,  //  -64.66 dB
-    5.88320619e-04f,  //  -64.61 dB
-    5.91905092e-04f,  //  -64.55 dB
-    5.95511405e-04f,  //  -64.50 dB
-    5.99139689e-04f,  //  -64.45 dB
-    6.02790080e-04f,  //  -64.40 dB
-    6.06462712e-04f,  //  -64.34 dB
-    6.10157720e-04f,  //  -64.29 dB
-    6.13875240e-04f,  //  -64.24 dB
-    6.17615411e-04f,  //  -64.19 dB
-    6.21378369e-04f,  //  -64.13 dB
-    6.25164254e-04f,  //  -64.08 dB
-    6.28973205e-04f,  //  -64.03 dB
-    6.32805363e-04f,  //  -63.97 dB
-    6.36660870e-04f,  //  -63.92 dB
-    6.40539867e-04f,  //  -63.87 dB
-    6.44442497e-04f,  //  -63.82 dB
-    6.48368906e-04f,  //  -63.76 dB
-    6.52319236e-04f,  //  -63.71 dB
-    6.56293635e-04f,  //  -63.66 dB
-    6.60292249e-04f,  //  -63.61 dB
-    6.64315225e-04f,  //  -63.55 dB
-    6.68362713e-04f,  //  -63.50 dB
-    6.72434860e-04f,  //  -63.45 dB
-    6.76531818e-04f,  //  -63.39 dB
-    6.80653737e-04f,  //  -63.34 dB
-    6.84800771e-04f,  //  -63.29 dB
-    6.88973070e-04f,  //  -63.24 dB
-    6.93170791e-04f,  //  -63.18 dB
-    6.97394087e-04f,  //  -63.13 dB
-    7.01643115e-04f,  //  -63.08 dB
-    7.05918030e-04f,  //  -63.02 dB
-    7.10218992e-04f,  //  -62.97 dB
-    7.14546158e-04f,  //  -62.92 dB
-    7.18899688e-04f,  //  -62.87 dB
-    7.23279743e-04f,  //  -62.81 dB
-    7.27686485e-04f,  //  -62.76 dB
-    7.32120075e-04f,  //  -62.71 dB
-    7.36580678e-04f,  //  -62.66 dB
-    7.41068459e-04f,  //  -62.60 dB
-    7.45583582e-04f,  //  -62.55 dB
-    7.50126215e-04f,  //  -62.50 dB
-    7.54696524e-04f,  //  -62.44 dB
-    7.59294679e-04f,  //  -62.39 dB
-    7.63920850e-04f,  //  -62.34 dB
-    7.68575206e-04f,  //  -62.29 dB
-    7.73257920e-04f,  //  -62.23 dB
-    7.77969165e-04f,  //  -62.18 dB
-    7.82709114e-04f,  //  -62.13 dB
-    7.87477942e-04f,  //  -62.08 dB
-    7.92275825e-04f,  //  -62.02 dB
-    7.97102941e-04f,  //  -61.97 dB
-    8.01959466e-04f,  //  -61.92 dB
-    8.06845581e-04f,  //  -61.86 dB
-    8.11761466e-04f,  //  -61.81 dB
-    8.16707302e-04f,  //  -61.76 dB
-    8.21683272e-04f,  //  -61.71 dB
-    8.26689559e-04f,  //  -61.65 dB
-    8.31726347e-04f,  //  -61.60 dB
-    8.36793824e-04f,  //  -61.55 dB
-    8.41892175e-04f,  //  -61.49 dB
-    8.47021589e-04f,  //  -61.44 dB
-    8.52182255e-04f,  //  -61.39 dB
-    8.57374363e-04f,  //  -61.34 dB
-    8.62598106e-04f,  //  -61.28 dB
-    8.67853675e-04f,  //  -61.23 dB
-    8.73141266e-04f,  //  -61.18 dB
-    8.78461072e-04f,  //  -61.13 dB
-    8.83813290e-04f,  //  -61.07 dB
-    8.89198117e-04f,  //  -61.02 dB
-    8.94615753e-04f,  //  -60.97 dB
-    9.00066397e-04f,  //  -60.91 dB
-    9.05550250e-04f,  //  -60.86 dB
-    9.11067515e-04f,  //  -60.81 dB
-    9.16618395e-04f,  //  -60.76 dB
-    9.22203095e-04f,  //  -60.70 dB
-    9.27821821e-04f,  //  -60.65 dB
-    9.33474780e-04f,  //  -60.60 dB
-    9.39162182e-04f,  //  -60.55 dB
-    9.44884235e-04f,  //  -60.49 dB
-    9.50641150e-04f,  //  -60.44 dB
-    9.56433142e-04f,  //  -60.39 dB
-    9.62260422e-04f,  //  -60.33 dB
-    9.68123206e-04f,  //  -60.28 dB
-    9.74021710e-04f,  //  -60.23 dB
-    9.79956152e-04f,  //  -60.18 dB
-    9.85926752e-04f,  //  -60.12 dB
-    9.91933728e-04f,  //  -60.07 dB
-    9.97977303e-04f,  //  -60.02 dB
-    1.00405770e-03f,  //  -59.96 dB
-    1.01017514e-03f,  //  -59.91 dB
-    1.01632986e-03f,  //  -59.86 dB
-    1.02252207e-03f,  //  -59.81 dB
-    1.02875201e-03f,  //  -59.75 dB
-    1.03501991e-03f,  //  -59.70 dB
-    1.04132600e-03f,  //  -59.65 dB
-    1.04767051e-03f,  //  -59.60 dB
-    1.05405367e-03f,  //  -59.54 dB
-    1.06047573e-03f,  //  -59.49 dB
-    1.06693691e-03f,  //  -59.44 dB
-    1.07343746e-03f,  //  -59.38 dB
-    1.07997761e-03f,  //  -59.33 dB
-    1.08655762e-03f,  //  -59.28 dB
-    1.09317771e-03f,  //  -59.23 dB
-    1.09983813e-03f,  //  -59.17 dB
-    1.10653914e-03f,  //  -59.12 dB
-    1.11328098e-03f,  //  -59.07 dB
-    1.12006389e-03f,  //  -59.02 dB
-    1.12688812e-03f,  //  -58.96 dB
-    1.13375394e-03f,  //  -58.91 dB
-    1.14066158e-03f,  //  -58.86 dB
-    1.14761132e-03f,  //  -58.80 dB
-    1.15460339e-03f,  //  -58.75 dB
-    1.16163807e-03f,  //  -58.70 dB
-    1.16871560e-03f,  //  -58.65 dB
-    1.17583626e-03f,  //  -58.59 dB
-    1.18300030e-03f,  //  -58.54 dB
-    1.19020799e-03f,  //  -58.49 dB
-    1.19745960e-03f,  //  -58.43 dB
-    1.20475539e-03f,  //  -58.38 dB
-    1.21209562e-03f,  //  -58.33 dB
-    1.21948058e-03f,  //  -58.28 dB
-    1.22691054e-03f,  //  -58.22 dB
-    1.23438576e-03f,  //  -58.17 dB
-    1.24190653e-03f,  //  -58.12 dB
-    1.24947312e-03f,  //  -58.07 dB
-    1.25708581e-03f,  //  -58.01 dB
-    1.26474488e-03f,  //  -57.96 dB
-    1.27245062e-03f,  //  -57.91 dB
-    1.28020331e-03f,  //  -57.85 dB
-    1.28800323e-03f,  //  -57.80 dB
-    1.29585067e-03f,  //  -57.75 dB
-    1.30374593e-03f,  //  -57.70 dB
-    1.31168929e-03f,  //  -57.64 dB
-    1.31968105e-03f,  //  -57.59 dB
-    1.32772149e-03f,  //  -57.54 dB
-    1.33581093e-03f,  //  -57.49 dB
-    1.34394965e-03f,  //  -57.43 dB
-    1.35213796e-03f,  //  -57.38 dB
-    1.36037616e-03f,  //  -57.33 dB
-    1.36866455e-03f,  //  -57.27 dB
-    1.37700345e-03f,  //  -57.22 dB
-    1.38539314e-03f,  //  -57.17 dB
-    1.39383396e-03f,  //  -57.12 dB
-    1.40232620e-03f,  //  -57.06 dB
-    1.41087018e-03f,  //  -57.01 dB
-    1.41946622e-03f,  //  -56.96 dB
-    1.42811463e-03f,  //  -56.90 dB
-    1.43681573e-03f,  //  -56.85 dB
-    1.44556985e-03f,  //  -56.80 dB
-    1.45437730e-03f,  //  -56.75 dB
-    1.46323842e-03f,  //  -56.69 dB
-    1.47215352e-03f,  //  -56.64 dB
-    1.48112294e-03f,  //  -56.59 dB
-    1.49014701e-03f,  //  -56.54 dB
-    1.49922606e-03f,  //  -56.48 dB
-    1.50836043e-03f,  //  -56.43 dB
-    1.51755044e-03f,  //  -56.38 dB
-    1.52679646e-03f,  //  -56.32 dB
-    1.53609880e-03f,  //  -56.27 dB
-    1.54545782e-03f,  //  -56.22 dB
-    1.55487386e-03f,  //  -56.17 dB
-    1.56434728e-03f,  //  -56.11 dB
-    1.57387841e-03f,  //  -56.06 dB
-    1.58346761e-03f,  //  -56.01 dB
-    1.59311524e-03f,  //  -55.96 dB
-    1.60282164e-03f,  //  -55.90 dB
-    1.61258719e-03f,  //  -55.85 dB
-    1.62241223e-03f,  //  -55.80 dB
-    1.63229714e-03f,  //  -55.74 dB
-    1.64224227e-03f,  //  -55.69 dB
-    1.65224799e-03f,  //  -55.64 dB
-    1.66231468e-03f,  //  -55.59 dB
-    1.67244269e-03f,  //  -55.53 dB
-    1.68263242e-03f,  //  -55.48 dB
-    1.69288423e-03f,  //  -55.43 dB
-    1.70319850e-03f,  //  -55.37 dB
-    1.71357561e-03f,  //  -55.32 dB
-    1.72401595e-03f,  //  -55.27 dB
-    1.73451990e-03f,  //  -55.22 dB
-    1.74508785e-03f,  //  -55.16 dB
-    1.75572018e-03f,  //  -55.11 dB
-    1.76641729e-03f,  //  -55.06 dB
-    1.77717958e-03f,  //  -55.01 dB
-    1.78800744e-03f,  //  -54.95 dB
-    1.79890127e-03f,  //  -54.90 dB
-    1.80986147e-03f,  //  -54.85 dB
-    1.82088845e-03f,  //  -54.79 dB
-    1.83198262e-03f,  //  -54.74 dB
-    1.84314437e-03f,  //  -54.69 dB
-    1.85437414e-03f,  //  -54.64 dB
-    1.86567232e-03f,  //  -54.58 dB
-    1.87703934e-03f,  //  -54.53 dB
-    1.88847562e-03f,  //  -54.48 dB
-    1.89998157e-03f,  //  -54.43 dB
-    1.91155763e-03f,  //  -54.37 dB
-    1.92320422e-03f,  //  -54.32 dB
-    1.93492177e-03f,  //  -54.27 dB
-    1.94671070e-03f,  //  -54.21 dB
-    1.95857147e-03f,  //  -54.16 dB
-    1.97050450e-03f,  //  -54.11 dB
-    1.98251023e-03f,  //  -54.06 dB
-    1.99458911e-03f,  //  -54.00 dB
-    2.00674159e-03f,  //  -53.95 dB
-    2.01896810e-03f,  //  -53.90 dB
-    2.03126911e-03f,  //  -53.84 dB
-    2.04364507e-03f,  //  -53.79 dB
-    2.05609643e-03f,  //  -53.74 dB
-    2.06862365e-03f,  //  -53.69 dB
-    2.08122719e-03f,  //  -53.63 dB
-    2.09390753e-03f,  //  -53.58 dB
-    2.10666512e-03f,  //  -53.53 dB
-    2.11950045e-03f,  //  -53.48 dB
-    2.13241397e-03f,  //  -53.42 dB
-    2.14540617e-03f,  //  -53.37 dB
-    2.15847754e-03f,  //  -53.32 dB
-    2.17162854e-03f,  //  -53.26 dB
-    2.18485966e-03f,  //  -53.21 dB
-    2.19817140e-03f,  //  -53.16 dB
-    2.21156425e-03f,  //  -53.11 dB
-    2.22503869e-03f,  //  -53.05 dB
-    2.23859523e-03f,  //  -53.00 dB
-    2.25223437e-03f,  //  -52.95 dB
-    2.26595660e-03f,  //  -52.89 dB
-    2.27976244e-03f,  //  -52.84 dB
-    2.29365240e-03f,  //  -52.79 dB
-    2.30762698e-03f,  //  -52.74 dB
-    2.32168671e-03f,  //  -52.68 dB
-    2.33583210e-03f,  //  -52.63 dB
-    2.35006367e-03f,  //  -52.58 dB
-    2.36438195e-03f,  //  -52.53 dB
-    2.37878747e-03f,  //  -52.47 dB
-    2.39328076e-03f,  //  -52.42 dB
-    2.40786235e-03f,  //  -52.37 dB
-    2.42253278e-03f,  //  -52.31 dB
-    2.43729260e-03f,  //  -52.26 dB
-    2.45214234e-03f,  //  -52.21 dB
-    2.46708256e-03f,  //  -52.16 dB
-    2.48211381e-03f,  //  -52.10 dB
-    2.49723663e-03f,  //  -52.05 dB
-    2.51245160e-03f,  //  -52.00 dB
-    2.52775926e-03f,  //  -51.95 dB
-    2.54316020e-03f,  //  -51.89 dB
-    2.55865496e-03f,  //  -51.84 dB
-    2.57424413e-03f,  //  -51.79 dB
-    2.58992828e-03f,  //  -51.73 dB
-    2.60570799e-03f,  //  -51.68 dB
-    2.62158384e-03f,  //  -51.63 dB
-    2.63755642e-03f,  //  -51.58 dB
-    2.65362632e-03f,  //  -51.52 dB
-    2.66979412e-03f,  //  -51.47 dB
-    2.68606043e-03f,  //  -51.42 dB
-    2.70242585e-03f,  //  -51.36 dB
-    2.71889097e-03f,  //  -51.31 dB
-    2.73545642e-03f,  //  -51.26 dB
-    2.75212279e-03f,  //  -51.21 dB
-    2.76889070e-03f,  //  -51.15 dB
-    2.78576078e-03f,  //  -51.10 dB
-    2.80273365e-03f,  //  -51.05 dB
-    2.81980992e-03f,  //  -51.00 dB
-    2.83699023e-03f,  //  -50.94 dB
-    2.85427522e-03f,  //  -50.89 dB
-    2.87166553e-03f,  //  -50.84 dB
-    2.88916178e-03f,  //  -50.78 dB
-    2.90676464e-03f,  //  -50.73 dB
-    2.92447474e-03f,  //  -50.68 dB
-    2.94229275e-03f,  //  -50.63 dB
-    2.96021932e-03f,  //  -50.57 dB
-    2.97825511e-03f,  //  -50.52 dB
-    2.99640079e-03f,  //  -50.47 dB
-    3.01465702e-03f,  //  -50.42 dB
-    3.03302448e-03f,  //  -50.36 dB
-    3.05150385e-03f,  //  -50.31 dB
-    3.07009582e-03f,  //  -50.26 dB
-    3.08880105e-03f,  //  -50.20 dB
-    3.10762025e-03f,  //  -50.15 dB
-    3.12655412e-03f,  //  -50.10 dB
-    3.14560334e-03f,  //  -50.05 dB
-    3.16476862e-03f,  //  -49.99 dB
-    3.18405067e-03f,  //  -49.94 dB
-    3.20345020e-03f,  //  -49.89 dB
-    3.22296793e-03f,  //  -49.83 dB
-    3.24260458e-03f,  //  -49.78 dB
-    3.26236086e-03f,  //  -49.73 dB
-    3.28223751e-03f,  //  -49.68 dB
-    3.30223527e-03f,  //  -49.62 dB
-    3.32235487e-03f,  //  -49.57 dB
-    3.34259705e-03f,  //  -49.52 dB
-    3.36296256e-03f,  //  -49.47 dB
-    3.38345215e-03f,  //  -49.41 dB
-    3.40406658e-03f,  //  -49.36 dB
-    3.42480661e-03f,  //  -49.31 dB
-    3.44567300e-03f,  //  -49.25 dB
-    3.46666652e-03f,  //  -49.20 dB
-    3.48778795e-03f,  //  -49.15 dB
-    3.50903807e-03f,  //  -49.10 dB
-    3.53041766e-03f,  //  -49.04 dB
-    3.55192751e-03f,  //  -48.99 dB
-    3.57356841e-03f,  //  -48.94 dB
-    3.59534117e-03f,  //  -48.89 dB
-    3.61724658e-03f,  //  -48.83 dB
-    3.63928545e-03f,  //  -48.78 dB
-    3.66145860e-03f,  //  -48.73 dB
-    3.68376685e-03f,  //  -48.67 dB
-    3.70621101e-03f,  //  -48.62 dB
-    3.72879192e-03f,  //  -48.57 dB
-    3.75151041e-03f,  //  -48.52 dB
-    3.77436731e-03f,  //  -48.46 dB
-    3.79736348e-03f,  //  -48.41 dB
-    3.82049975e-03f,  //  -48.36 dB
-    3.84377699e-03f,  //  -48.30 dB
-    3.86719605e-03f,  //  -48.25 dB
-    3.89075780e-03f,  //  -48.20 dB
-    3.91446310e-03f,  //  -48.15 dB
-    3.93831283e-03f,  //  -48.09 dB
-    3.96230787e-03f,  //  -48.04 dB
-    3.98644910e-03f,  //  -47.99 dB
-    4.01073743e-03f,  //  -47.94 dB
-    4.03517373e-03f,  //  -47.88 dB
-    4.05975892e-03f,  //  -47.83 dB
-    4.08449389e-03f,  //  -47.78 dB
-    4.10937957e-03f,  //  -47.72 dB
-    4.13441688e-03f,  //  -47.67 dB
-    4.15960672e-03f,  //  -47.62 dB
-    4.18495005e-03f,  //  -47.57 dB
-    4.21044778e-03f,  //  -47.51 dB
-    4.23610086e-03f,  //  -47.46 dB
-    4.26191024e-03f,  //  -47.41 dB
-    4.28787687e-03f,  //  -47.36 dB
-    4.31400171e-03f,  //  -47.30 dB
-    4.34028572e-03f,  //  -47.25 dB
-    4.36672986e-03f,  //  -47.20 dB
-    4.39333513e-03f,  //  -47.14 dB
-    4.42010249e-03f,  //  -47.09 dB
-    4.44703294e-03f,  //  -47.04 dB
-    4.47412748e-03f,  //  -46.99 dB
-    4.50138708e-03f,  //  -46.93 dB
-    4.52881278e-03f,  //  -46.88 dB
-    4.55640557e-03f,  //  -46.83 dB
-    4.58416648e-03f,  //  -46.77 dB
-    4.61209652e-03f,  //  -46.72 dB
-    4.64019674e-03f,  //  -46.67 dB
-    4.66846816e-03f,  //  -46.62 dB
-    4.69691184e-03f,  //  -46.56 dB
-    4.72552881e-03f,  //  -46.51 dB
-    4.75432014e-03f,  //  -46.46 dB
-    4.78328688e-03f,  //  -46.41 dB
-    4.81243011e-03f,  //  -46.35 dB
-    4.84175091e-03f,  //  -46.30 dB
-    4.87125034e-03f,  //  -46.25 dB
-    4.90092951e-03f,  //  -46.19 dB
-    4.93078951e-03f,  //  -46.14 dB
-    4.96083143e-03f,  //  -46.09 dB
-    4.99105639e-03f,  //  -46.04 dB
-    5.02146550e-03f,  //  -45.98 dB
-    5.05205989e-03f,  //  -45.93 dB
-    5.08284068e-03f,  //  -45.88 dB
-    5.11380901e-03f,  //  -45.83 dB
-    5.14496602e-03f,  //  -45.77 dB
-    5.17631286e-03f,  //  -45.72 dB
-    5.20785069e-03f,  //  -45.67 dB
-    5.23958067e-03f,  //  -45.61 dB
-    5.27150398e-03f,  //  -45.56 dB
-    5.30362178e-03f,  //  -45.51 dB
-    5.33593526e-03f,  //  -45.46 dB
-    5.36844563e-03f,  //  -45.40 dB
-    5.40115407e-03f,  //  -45.35 dB
-    5.43406179e-03f,  //  -45.30 dB
-    5.46717001e-03f,  //  -45.24 dB
-    5.50047995e-03f,  //  -45.19 dB
-    5.53399284e-03f,  //  -45.14 dB
-    5.56770992e-03f,  //  -45.09 dB
-    5.60163242e-03f,  //  -45.03 dB
-    5.63576160e-03f,  //  -44.98 dB
-    5.67009872e-03f,  //  -44.93 dB
-    5.70464505e-03f,  //  -44.88 dB
-    5.73940186e-03f,  //  -44.82 dB
-    5.77437043e-03f,  //  -44.77 dB
-    5.80955206e-03f,  //  -44.72 dB
-    5.84494804e-03f,  //  -44.66 dB
-    5.88055967e-03f,  //  -44.61 dB
-    5.91638828e-03f,  //  -44.56 dB
-    5.95243518e-03f,  //  -44.51 dB
-    5.98870171e-03f,  //  -44.45 dB
-    6.02518920e-03f,  //  -44.40 dB
-    6.06189899e-03f,  //  -44.35 dB
-    6.09883245e-03f,  //  -44.30 dB
-    6.13599093e-03f,  //  -44.24 dB
-    6.17337581e-03f,  //  -44.19 dB
-    6.21098847e-03f,  //  -44.14 dB
-    6.24883029e-03f,  //  -44.08 dB
-    6.28690267e-03f,  //  -44.03 dB
-    6.32520701e-03f,  //  -43.98 dB
-    6.36374473e-03f,  //  -43.93 dB
-    6.40251725e-03f,  //  -43.87 dB
-    6.44152600e-03f,  //  -43.82 dB
-    6.48077242e-03f,  //  -43.77 dB
-    6.52025796e-03f,  //  -43.71 dB
-    6.55998407e-03f,  //  -43.66 dB
-    6.59995222e-03f,  //  -43.61 dB
-    6.64016388e-03f,  //  -43.56 dB
-    6.68062055e-03f,  //  -43.50 dB
-    6.72132371e-03f,  //  -43.45 dB
-    6.76227485e-03f,  //  -43.40 dB
-    6.80347551e-03f,  //  -43.35 dB
-    6.84492718e-03f,  //  -43.29 dB
-    6.88663141e-03f,  //  -43.24 dB
-    6.92858974e-03f,  //  -43.19 dB
-    6.97080370e-03f,  //  -43.13 dB
-    7.01327486e-03f,  //  -43.08 dB
-    7.05600478e-03f,  //  -43.03 dB
-    7.09899505e-03f,  //  -42.98 dB
-    7.14224725e-03f,  //  -42.92 dB
-    7.18576297e-03f,  //  -42.87 dB
-    7.22954381e-03f,  //  -42.82 dB
-    7.27359140e-03f,  //  -42.77 dB
-    7.31790737e-03f,  //  -42.71 dB
-    7.36249333e-03f,  //  -42.66 dB
-    7.40735095e-03f,  //  -42.61 dB
-    7.45248187e-03f,  //  -42.55 dB
-    7.49788776e-03f,  //  -42.50 dB
-    7.54357030e-03f,  //  -42.45 dB
-    7.58953117e-03f,  //  -42.40 dB
-    7.63577206e-03f,  //  -42.34 dB
-    7.68229469e-03f,  //  -42.29 dB
-    7.72910076e-03f,  //  -42.24 dB
-    7.77619202e-03f,  //  -42.18 dB
-    7.82357018e-03f,  //  -42.13 dB
-    7.87123701e-03f,  //  -42.08 dB
-    7.91919426e-03f,  //  -42.03 dB
-    7.96744370e-03f,  //  -41.97 dB
-    8.01598711e-03f,  //  -41.92 dB
-    8.06482628e-03f,  //  -41.87 dB
-    8.11396302e-03f,  //  -41.82 dB
-    8.16339913e-03f,  //  -41.76 dB
-    8.21313644e-03f,  //  -41.71 dB
-    8.26317679e-03f,  //  -41.66 dB
-    8.31352202e-03f,  //  -41.60 dB
-    8.36417399e-03f,  //  -41.55 dB
-    8.41513456e-03f,  //  -41.50 dB
-    8.46640563e-03f,  //  -41.45 dB
-    8.51798907e-03f,  //  -41.39 dB
-    8.56988680e-03f,  //  -41.34 dB
-    8.62210073e-03f,  //  -41.29 dB
-    8.67463278e-03f,  //  -41.23 dB
-    8.72748490e-03f,  //  -41.18 dB
-    8.78065903e-03f,  //  -41.13 dB
-    8.83415713e-03f,  //  -41.08 dB
-    8.88798118e-03f,  //  -41.02 dB
-    8.94213317e-03f,  //  -40.97 dB
-    8.99661509e-03f,  //  -40.92 dB
-    9.05142896e-03f,  //  -40.87 dB
-    9.10657679e-03f,  //  -40.81 dB
-    9.16206062e-03f,  //  -40.76 dB
-    9.21788249e-03f,  //  -40.71 dB
-    9.27404448e-03f,  //  -40.65 dB
-    9.33054864e-03f,  //  -40.60 dB
-    9.38739707e-03f,  //  -40.55 dB
-    9.44459186e-03f,  //  -40.50 dB
-    9.50213512e-03f,  //  -40.44 dB
-    9.56002898e-03f,  //  -40.39 dB
-    9.61827556e-03f,  //  -40.34 dB
-    9.67687703e-03f,  //  -40.29 dB
-    9.73583554e-03f,  //  -40.23 dB
-    9.79515327e-03f,  //  -40.18 dB
-    9.85483240e-03f,  //  -40.13 dB
-    9.91487514e-03f,  //  -40.07 dB
-    9.97528371e-03f,  //  -40.02 dB
-    1.00360603e-02f,  //  -39.97 dB
-    1.00972072e-02f,  //  -39.92 dB
-    1.01587267e-02f,  //  -39.86 dB
-    1.02206210e-02f,  //  -39.81 dB
-    1.02828924e-02f,  //  -39.76 dB
-    1.03455432e-02f,  //  -39.70 dB
-    1.04085757e-02f,  //  -39.65 dB
-    1.04719922e-02f,  //  -39.60 dB
-    1.05357952e-02f,  //  -39.55 dB
-    1.05999868e-02f,  //  -39.49 dB
-    1.06645696e-02f,  //  -39.44 dB
-    1.07295458e-02f,  //  -39.39 dB
-    1.07949179e-02f,  //  -39.34 dB
-    1.08606884e-02f,  //  -39.28 dB
-    1.09268595e-02f,  //  -39.23 dB
-    1.09934338e-02f,  //  -39.18 dB
-    1.10604137e-02f,  //  -39.12 dB
-    1.11278017e-02f,  //  -39.07 dB
-    1.11956003e-02f,  //  -39.02 dB
-    1.12638120e-02f,  //  -38.97 dB
-    1.13324393e-02f,  //  -38.91 dB
-    1.14014847e-02f,  //  -38.86 dB
-    1.14709507e-02f,  //  -38.81 dB
-    1.15408400e-02f,  //  -38.76 dB
-    1.16111551e-02f,  //  -38.70 dB
-    1.16818987e-02f,  //  -38.65 dB
-    1.17530732e-02f,  //  -38.60 dB
-    1.18246814e-02f,  //  -38.54 dB
-    1.18967259e-02f,  //  -38.49 dB
-    1.19692093e-02f,  //  -38.44 dB
-    1.20421344e-02f,  //  -38.39 dB
-    1.21155037e-02f,  //  -38.33 dB
-    1.21893201e-02f,  //  -38.28 dB
-    1.22635862e-02f,  //  -38.23 dB
-    1.23383048e-02f,  //  -38.17 dB
-    1.24134787e-02f,  //  -38.12 dB
-    1.24891105e-02f,  //  -38.07 dB
-    1.25652032e-02f,  //  -38.02 dB
-    1.26417595e-02f,  //  -37.96 dB
-    1.27187822e-02f,  //  -37.91 dB
-    1.27962742e-02f,  //  -37.86 dB
-    1.28742383e-02f,  //  -37.81 dB
-    1.29526774e-02f,  //  -37.75 dB
-    1.30315945e-02f,  //  -37.70 dB
-    1.31109924e-02f,  //  -37.65 dB
-    1.31908740e-02f,  //  -37.59 dB
-    1.32712423e-02f,  //  -37.54 dB
-    1.33521003e-02f,  //  -37.49 dB
-    1.34334509e-02f,  //  -37.44 dB
-    1.35152971e-02f,  //  -37.38 dB
-    1.35976421e-02f,  //  -37.33 dB
-    1.36804887e-02f,  //  -37.28 dB
-    1.37638401e-02f,  //  -37.23 dB
-    1.38476993e-02f,  //  -37.17 dB
-    1.39320695e-02f,  //  -37.12 dB
-    1.40169537e-02f,  //  -37.07 dB
-    1.41023551e-02f,  //  -37.01 dB
-    1.41882768e-02f,  //  -36.96 dB
-    1.42747220e-02f,  //  -36.91 dB
-    1.43616939e-02f,  //  -36.86 dB
-    1.44491957e-02f,  //  -36.80 dB
-    1.45372306e-02f,  //  -36.75 dB
-    1.46258019e-02f,  //  -36.70 dB
-    1.47149128e-02f,  //  -36.64 dB
-    1.48045667e-02f,  //  -36.59 dB
-    1.48947668e-02f,  //  -36.54 dB
-    1.49855164e-02f,  //  -36.49 dB
-    1.50768190e-02f,  //  -36.43 dB
-    1.51686779e-02f,  //  -36.38 dB
-    1.52610964e-02f,  //  -36.33 dB
-    1.53540780e-02f,  //  -36.28 dB
-    1.54476261e-02f,  //  -36.22 dB
-    1.55417442e-02f,  //  -36.17 dB
-    1.56364357e-02f,  //  -36.12 dB
-    1.57317041e-02f,  //  -36.06 dB
-    1.58275530e-02f,  //  -36.01 dB
-    1.59239859e-02f,  //  -35.96 dB
-    1.60210063e-02f,  //  -35.91 dB
-    1.61186178e-02f,  //  -35.85 dB
-    1.62168240e-02f,  //  -35.80 dB
-    1.63156286e-02f,  //  -35.75 dB
-    1.64150352e-02f,  //  -35.70 dB
-    1.65150474e-02f,  //  -35.64 dB
-    1.66156690e-02f,  //  -35.59 dB
-    1.67169036e-02f,  //  -35.54 dB
-    1.68187550e-02f,  //  -35.48 dB
-    1.69212270e-02f,  //  -35.43 dB
-    1.70243233e-02f,  //  -35.38 dB
-    1.71280478e-02f,  //  -35.33 dB
-    1.72324042e-02f,  //  -35.27 dB
-    1.73373964e-02f,  //  -35.22 dB
-    1.74430283e-02f,  //  -35.17 dB
-    1.75493038e-02f,  //  -35.11 dB
-    1.76562268e-02f,  //  -35.06 dB
-    1.77638013e-02f,  //  -35.01 dB
-    1.78720312e-02f,  //  -34.96 dB
-    1.79809205e-02f,  //  -34.90 dB
-    1.80904732e-02f,  //  -34.85 dB
-    1.82006934e-02f,  //  -34.80 dB
-    1.83115851e-02f,  //  -34.75 dB
-    1.84231525e-02f,  //  -34.69 dB
-    1.85353996e-02f,  //  -34.64 dB
-    1.86483306e-02f,  //  -34.59 dB
-    1.87619497e-02f,  //  -34.53 dB
-    1.88762610e-02f,  //  -34.48 dB
-    1.89912688e-02f,  //  -34.43 dB
-    1.91069773e-02f,  //  -34.38 dB
-    1.92233908e-02f,  //  -34.32 dB
-    1.93405136e-02f,  //  -34.27 dB
-    1.94583499e-02f,  //  -34.22 dB
-    1.95769042e-02f,  //  -34.17 dB
-    1.96961808e-02f,  //  -34.11 dB
-    1.98161841e-02f,  //  -34.06 dB
-    1.99369186e-02f,  //  -34.01 dB
-    2.00583887e-02f,  //  -33.95 dB
-    2.01805989e-02f,  //  -33.90 dB
-    2.03035536e-02f,  //  -33.85 dB
-    2.04272575e-02f,  //  -33.80 dB
-    2.05517151e-02f,  //  -33.74 dB
-    2.06769309e-02f,  //  -33.69 dB
-    2.08029097e-02f,  //  -33.64 dB
-    2.09296560e-02f,  //  -33.58 dB
-    2.10571746e-02f,  //  -33.53 dB
-    2.11854701e-02f,  //  -33.48 dB
-    2.13145472e-02f,  //  -33.43 dB
-    2.14444108e-02f,  //  -33.37 dB
-    2.15750656e-02f,  //  -33.32 dB
-    2.17065165e-02f,  //  -33.27 dB
-    2.18387682e-02f,  //  -33.22 dB
-    2.19718257e-02f,  //  -33.16 dB
-    2.21056939e-02f,  //  -33.11 dB
-    2.22403777e-02f,  //  -33.06 dB
-    2.23758822e-02f,  //  -33.00 dB
-    2.25122122e-02f,  //  -32.95 dB
-    2.26493728e-02f,  //  -32.90 dB
-    2.27873691e-02f,  //  -32.85 dB
-    2.29262062e-02f,  //  -32.79 dB
-    2.30658891e-02f,  //  -32.74 dB
-    2.32064232e-02f,  //  -32.69 dB
-    2.33478134e-02f,  //  -32.64 dB
-    2.34900651e-02f,  //  -32.58 dB
-    2.36331835e-02f,  //  -32.53 dB
-    2.37771739e-02f,  //  -32.48 dB
-    2.39220416e-02f,  //  -32.42 dB
-    2.40677919e-02f,  //  -32.37 dB
-    2.42144303e-02f,  //  -32.32 dB
-    2.43619620e-02f,  //  -32.27 dB
-    2.45103927e-02f,  //  -32.21 dB
-    2.46597276e-02f,  //  -32.16 dB
-    2.48099725e-02f,  //  -32.11 dB
-    2.49611327e-02f,  //  -32.05 dB
-    2.51132139e-02f,  //  -32.00 dB
-    2.52662217e-02f,  //  -31.95 dB
-    2.54201618e-02f,  //  -31.90 dB
-    2.55750397e-02f,  //  -31.84 dB
-    2.57308613e-02f,  //  -31.79 dB
-    2.58876322e-02f,  //  -31.74 dB
-    2.60453583e-02f,  //  -31.69 dB
-    2.62040454e-02f,  //  -31.63 dB
-    2.63636994e-02f,  //  -31.58 dB
-    2.65243260e-02f,  //  -31.53 dB
-    2.66859313e-02f,  //  -31.47 dB
-    2.68485213e-02f,  //  -31.42 dB
-    2.70121018e-02f,  //  -31.37 dB
-    2.71766790e-02f,  //  -31.32 dB
-    2.73422589e-02f,  //  -31.26 dB
-    2.75088477e-02f,  //  -31.21 dB
-    2.76764514e-02f,  //  -31.16 dB
-    2.78450763e-02f,  //  -31.11 dB
-    2.80147286e-02f,  //  -31.05 dB
-    2.81854145e-02f,  //  -31.00 dB
-    2.83571404e-02f,  //  -30.95 dB
-    2.85299125e-02f,  //  -30.89 dB
-    2.87037373e-02f,  //  -30.84 dB
-    2.88786211e-02f,  //  -30.79 dB
-    2.90545705e-02f,  //  -30.74 dB
-    2.92315919e-02f,  //  -30.68 dB
-    2.94096918e-02f,  //  -30.63 dB
-    2.95888769e-02f,  //  -30.58 dB
-    2.97691536e-02f,  //  -30.52 dB
-    2.99505288e-02f,  //  -30.47 dB
-    3.01330090e-02f,  //  -30.42 dB
-    3.03166010e-02f,  //  -30.37 dB
-    3.05013116e-02f,  //  -30.31 dB
-    3.06871476e-02f,  //  -30.26 dB
-    3.08741158e-02f,  //  -30.21 dB
-    3.10622232e-02f,  //  -30.16 dB
-    3.12514766e-02f,  //  -30.10 dB
-    3.14418831e-02f,  //  -30.05 dB
-    3.16334497e-02f,  //  -30.00 dB
-    3.18261835e-02f,  //  -29.94 dB
-    3.20200916e-02f,  //  -29.89 dB
-    3.22151811e-02f,  //  -29.84 dB
-    3.24114592e-02f,  //  -29.79 dB
-    3.26089331e-02f,  //  -29.73 dB
-    3.28076103e-02f,  //  -29.68 dB
-    3.30074979e-02f,  //  -29.63 dB
-    3.32086033e-02f,  //  -29.57 dB
-    3.34109341e-02f,  //  -29.52 dB
-    3.36144976e-02f,  //  -29.47 dB
-    3.38193013e-02f,  //  -29.42 dB
-    3.40253529e-02f,  //  -29.36 dB
-    3.42326599e-02f,  //  -29.31 dB
-    3.44412299e-02f,  //  -29.26 dB
-    3.46510707e-02f,  //  -29.21 dB
-    3.48621900e-02f,  //  -29.15 dB
-    3.50745956e-02f,  //  -29.10 dB
-    3.52882953e-02f,  //  -29.05 dB
-    3.55032970e-02f,  //  -28.99 dB
-    3.57196087e-02f,  //  -28.94 dB
-    3.59372383e-02f,  //  -28.89 dB
-    3.61561939e-02f,  //  -28.84 dB
-    3.63764835e-02f,  //  -28.78 dB
-    3.65981152e-02f,  //  -28.73 dB
-    3.68210973e-02f,  //  -28.68 dB
-    3.70454380e-02f,  //  -28.63 dB
-    3.72711455e-02f,  //  -28.57 dB
-    3.74982282e-02f,  //  -28.52 dB
-    3.77266944e-02f,  //  -28.47 dB
-    3.79565526e-02f,  //  -28.41 dB
-    3.81878113e-02f,  //  -28.36 dB
-    3.84204790e-02f,  //  -28.31 dB
-    3.86545642e-02f,  //  -28.26 dB
-    3.88900757e-02f,  //  -28.20 dB
-    3.91270221e-02f,  //  -28.15 dB
-    3.93654121e-02f,  //  -28.10 dB
-    3.96052546e-02f,  //  -28.04 dB
-    3.98465583e-02f,  //  -27.99 dB
-    4.00893323e-02f,  //  -27.94 dB
-    4.03335854e-02f,  //  -27.89 dB
-    4.05793267e-02f,  //  -27.83 dB
-    4.08265652e-02f,  //  -27.78 dB
-    4.10753100e-02f,  //  -27.73 dB
-    4.13255704e-02f,  //  -27.68 dB
-    4.15773556e-02f,  //  -27.62 dB
-    4.18306748e-02f,  //  -27.57 dB
-    4.20855374e-02f,  //  -27.52 dB
-    4.23419529e-02f,  //  -27.46 dB
-    4.25999305e-02f,  //  -27.41 dB
-    4.28594800e-02f,  //  -27.36 dB
-    4.31206109e-02f,  //  -27.31 dB
-    4.33833327e-02f,  //  -27.25 dB
-    4.36476553e-02f,  //  -27.20 dB
-    4.39135882e-02f,  //  -27.15 dB
-    4.41811415e-02f,  //  -27.10 dB
-    4.44503248e-02f,  //  -27.04 dB
-    4.47211482e-02f,  //  -26.99 dB
-    4.49936217e-02f,  //  -26.94 dB
-    4.52677553e-02f,  //  -26.88 dB
-    4.55435591e-02f,  //  -26.83 dB
-    4.58210433e-02f,  //  -26.78 dB
-    4.61002181e-02f,  //  -26.73 dB
-    4.63810939e-02f,  //  -26.67 dB
-    4.66636809e-02f,  //  -26.62 dB
-    4.69479897e-02f,  //  -26.57 dB
-    4.72340307e-02f,  //  -26.51 dB
-    4.75218144e-02f,  //  -26.46 dB
-    4.78113516e-02f,  //  -26.41 dB
-    4.81026528e-02f,  //  -26.36 dB
-    4.83957288e-02f,  //  -26.30 dB
-    4.86905905e-02f,  //  -26.25 dB
-    4.89872487e-02f,  //  -26.20 dB
-    4.92857143e-02f,  //  -26.15 dB
-    4.95859984e-02f,  //  -26.09 dB
-    4.98881120e-02f,  //  -26.04 dB
-    5.01920664e-02f,  //  -25.99 dB
-    5.04978726e-02f,  //  -25.93 dB
-    5.08055421e-02f,  //  -25.88 dB
-    5.11150860e-02f,  //  -25.83 dB
-    5.14265160e-02f,  //  -25.78 dB
-    5.17398434e-02f,  //  -25.72 dB
-    5.20550798e-02f,  //  -25.67 dB
-    5.23722369e-02f,  //  -25.62 dB
-    5.26913263e-02f,  //  -25.57 dB
-    5.30123598e-02f,  //  -25.51 dB
-    5.33353494e-02f,  //  -25.46 dB
-    5.36603067e-02f,  //  -25.41 dB
-    5.39872440e-02f,  //  -25.35 dB
-    5.43161732e-02f,  //  -25.30 dB
-    5.46471065e-02f,  //  -25.25 dB
-    5.49800561e-02f,  //  -25.20 dB
-    5.53150342e-02f,  //  -25.14 dB
-    5.56520532e-02f,  //  -25.09 dB
-    5.59911257e-02f,  //  -25.04 dB
-    5.63322640e-02f,  //  -24.98 dB
-    5.66754807e-02f,  //  -24.93 dB
-    5.70207886e-02f,  //  -24.88 dB
-    5.73682003e-02f,  //  -24.83 dB
-    5.77177288e-02f,  //  -24.77 dB
-    5.80693868e-02f,  //  -24.72 dB
-    5.84231873e-02f,  //  -24.67 dB
-    5.87791435e-02f,  //  -24.62 dB
-    5.91372684e-02f,  //  -24.56 dB
-    5.94975753e-02f,  //  -24.51 dB
-    5.98600774e-02f,  //  -24.46 dB
-    6.02247881e-02f,  //  -24.40 dB
-    6.05917210e-02f,  //  -24.35 dB
-    6.09608894e-02f,  //  -24.30 dB
-    6.13323071e-02f,  //  -24.25 dB
-    6.17059877e-02f,  //  -24.19 dB
-    6.20819451e-02f,  //  -24.14 dB
-    6.24601930e-02f,  //  -24.09 dB
-    6.28407455e-02f,  //  -24.04 dB
-    6.32236166e-02f,  //  -23.98 dB
-    6.36088205e-02f,  //  -23.93 dB
-    6.39963713e-02f,  //  -23.88 dB
-    6.43862833e-02f,  //  -23.82 dB
-    6.47785709e-02f,  //  -23.77 dB
-    6.51732487e-02f,  //  -23.72 dB
-    6.55703311e-02f,  //  -23.67 dB
-    6.59698328e-02f,  //  -23.61 dB
-    6.63717686e-02f,  //  -23.56 dB
-    6.67761532e-02f,  //  -23.51 dB
-    6.71830017e-02f,  //  -23.45 dB
-    6.75923290e-02f,  //  -23.40 dB
-    6.80041502e-02f,  //  -23.35 dB
-    6.84184805e-02f,  //  -23.30 dB
-    6.88353352e-02f,  //  -23.24 dB
-    6.92547296e-02f,  //  -23.19 dB
-    6.96766794e-02f,  //  -23.14 dB
-    7.01011999e-02f,  //  -23.09 dB
-    7.05283070e-02f,  //  -23.03 dB
-    7.09580162e-02f,  //  -22.98 dB
-    7.13903436e-02f,  //  -22.93 dB
-    7.18253051e-02f,  //  -22.87 dB
-    7.22629166e-02f,  //  -22.82 dB
-    7.27031944e-02f,  //  -22.77 dB
-    7.31461546e-02f,  //  -22.72 dB
-    7.35918137e-02f,  //  -22.66 dB
-    7.40401881e-02f,  //  -22.61 dB
-    7.44912943e-02f,  //  -22.56 dB
-    7.49451490e-02f,  //  -22.51 dB
-    7.54017688e-02f,  //  -22.45 dB
-    7.58611707e-02f,  //  -22.40 dB
-    7.63233717e-02f,  //  -22.35 dB
-    7.67883887e-02f,  //  -22.29 dB
-    7.72562389e-02f,  //  -22.24 dB
-    7.77269396e-02f,  //  -22.19 dB
-    7.82005081e-02f,  //  -22.14 dB
-    7.86769620e-02f,  //  -22.08 dB
-    7.91563187e-02f,  //  -22.03 dB
-    7.96385961e-02f,  //  -21.98 dB
-    8.01238118e-02f,  //  -21.92 dB
-    8.06119838e-02f,  //  -21.87 dB
-    8.11031302e-02f,  //  -21.82 dB
-    8.15972689e-02f,  //  -21.77 dB
-    8.20944183e-02f,  //  -21.71 dB
-    8.25945966e-02f,  //  -21.66 dB
-    8.30978224e-02f,  //  -21.61 dB
-    8.36041143e-02f,  //  -21.56 dB
-    8.41134908e-02f,  //  -21.50 dB
-    8.46259708e-02f,  //  -21.45 dB
-    8.51415732e-02f,  //  -21.40 dB
-    8.56603171e-02f,  //  -21.34 dB
-    8.61822215e-02f,  //  -21.29 dB
-    8.67073057e-02f,  //  -21.24 dB
-    8.72355891e-02f,  //  -21.19 dB
-    8.77670912e-02f,  //  -21.13 dB
-    8.83018315e-02f,  //  -21.08 dB
-    8.88398300e-02f,  //  -21.03 dB
-    8.93811062e-02f,  //  -20.98 dB
-    8.99256804e-02f,  //  -20.92 dB
-    9.04735724e-02f,  //  -20.87 dB
-    9.10248026e-02f,  //  -20.82 dB
-    9.15793913e-02f,  //  -20.76 dB
-    9.21373590e-02f,  //  -20.71 dB
-    9.26987262e-02f,  //  -20.66 dB
-    9.32635137e-02f,  //  -20.61 dB
-    9.38317422e-02f,  //  -20.55 dB
-    9.44034328e-02f,  //  -20.50 dB
-    9.49786066e-02f,  //  -20.45 dB
-    9.55572847e-02f,  //  -20.39 dB
-    9.61394886e-02f,  //  -20.34 dB
-    9.67252396e-02f,  //  -20.29 dB
-    9.73145595e-02f,  //  -20.24 dB
-    9.79074700e-02f,  //  -20.18 dB
-    9.85039928e-02f,  //  -20.13 dB
-    9.91041502e-02f,  //  -20.08 dB
-    9.97079641e-02f,  //  -20.03 dB
-    1.00315457e-01f,  //  -19.97 dB
-    1.00926651e-01f,  //  -19.92 dB
-    1.01541569e-01f,  //  -19.87 dB
-    1.02160233e-01f,  //  -19.81 dB
-    1.02782667e-01f,  //  -19.76 dB
-    1.03408893e-01f,  //  -19.71 dB
-    1.04038935e-01f,  //  -19.66 dB
-    1.04672815e-01f,  //  -19.60 dB
-    1.05310557e-01f,  //  -19.55 dB
-    1.05952185e-01f,  //  -19.50 dB
-    1.06597722e-01f,  //  -19.45 dB
-    1.07247192e-01f,  //  -19.39 dB
-    1.07900619e-01f,  //  -19.34 dB
-    1.08558028e-01f,  //  -19.29 dB
-    1.09219441e-01f,  //  -19.23 dB
-    1.09884885e-01f,  //  -19.18 dB
-    1.10554383e-01f,  //  -19.13 dB
-    1.11227960e-01f,  //  -19.08 dB
-    1.11905641e-01f,  //  -19.02 dB
-    1.12587451e-01f,  //  -18.97 dB
-    1.13273415e-01f,  //  -18.92 dB
-    1.13963558e-01f,  //  -18.86 dB
-    1.14657906e-01f,  //  -18.81 dB
-    1.15356485e-01f,  //  -18.76 dB
-    1.16059319e-01f,  //  -18.71 dB
-    1.16766436e-01f,  //  -18.65 dB
-    1.17477862e-01f,  //  -18.60 dB
-    1.18193622e-01f,  //  -18.55 dB
-    1.18913742e-01f,  //  -18.50 dB
-    1.19638251e-01f,  //  -18.44 dB
-    1.20367173e-01f,  //  -18.39 dB
-    1.21100537e-01f,  //  -18.34 dB
-    1.21838368e-01f,  //  -18.28 dB
-    1.22580695e-01f,  //  -18.23 dB
-    1.23327545e-01f,  //  -18.18 dB
-    1.24078946e-01f,  //  -18.13 dB
-    1.24834924e-01f,  //  -18.07 dB
-    1.25595508e-01f,  //  -18.02 dB
-    1.26360727e-01f,  //  -17.97 dB
-    1.27130607e-01f,  //  -17.91 dB
-    1.27905179e-01f,  //  -17.86 dB
-    1.28684469e-01f,  //  -17.81 dB
-    1.29468508e-01f,  //  -17.76 dB
-    1.30257323e-01f,  //  -17.70 dB
-    1.31050945e-01f,  //  -17.65 dB
-    1.31849402e-01f,  //  -17.60 dB
-    1.32652723e-01f,  //  -17.55 dB
-    1.33460939e-01f,  //  -17.49 dB
-    1.34274079e-01f,  //  -17.44 dB
-    1.35092174e-01f,  //  -17.39 dB
-    1.35915253e-01f,  //  -17.33 dB
-    1.36743347e-01f,  //  -17.28 dB
-    1.37576486e-01f,  //  -17.23 dB
-    1.38414701e-01f,  //  -17.18 dB
-    1.39258023e-01f,  //  -17.12 dB
-    1.40106483e-01f,  //  -17.07 dB
-    1.40960113e-01f,  //  -17.02 dB
-    1.41818943e-01f,  //  -16.97 dB
-    1.42683007e-01f,  //  -16.91 dB
-    1.43552334e-01f,  //  -16.86 dB
-    1.44426959e-01f,  //  -16.81 dB
-    1.45306912e-01f,  //  -16.75 dB
-    1.46192226e-01f,  //  -16.70 dB
-    1.47082935e-01f,  //  -16.65 dB
-    1.47979070e-01f,  //  -16.60 dB
-    1.48880665e-01f,  //  -16.54 dB
-    1.49787753e-01f,  //  -16.49 dB
-    1.50700368e-01f,  //  -16.44 dB
-    1.51618544e-01f,  //  -16.38 dB
-    1.52542313e-01f,  //  -16.33 dB
-    1.53471711e-01f,  //  -16.28 dB
-    1.54406771e-01f,  //  -16.23 dB
-    1.55347528e-01f,  //  -16.17 dB
-    1.56294017e-01f,  //  -16.12 dB
-    1.57246273e-01f,  //  -16.07 dB
-    1.58204331e-01f,  //  -16.02 dB
-    1.59168226e-01f,  //  -15.96 dB
-    1.60137993e-01f,  //  -15.91 dB
-    1.61113669e-01f,  //  -15.86 dB
-    1.62095290e-01f,  //  -15.80 dB
-    1.63082891e-01f,  //  -15.75 dB
-    1.64076510e-01f,  //  -15.70 dB
-    1.65076182e-01f,  //  -15.65 dB
-    1.66081945e-01f,  //  -15.59 dB
-    1.67093836e-01f,  //  -15.54 dB
-    1.68111892e-01f,  //  -15.49 dB
-    1.69136151e-01f,  //  -15.44 dB
-    1.70166650e-01f,  //  -15.38 dB
-    1.71203428e-01f,  //  -15.33 dB
-    1.72246523e-01f,  //  -15.28 dB
-    1.73295973e-01f,  //  -15.22 dB
-    1.74351817e-01f,  //  -15.17 dB
-    1.75414094e-01f,  //  -15.12 dB
-    1.76482843e-01f,  //  -15.07 dB
-    1.77558104e-01f,  //  -15.01 dB
-    1.78639916e-01f,  //  -14.96 dB
-    1.79728319e-01f,  //  -14.91 dB
-    1.80823353e-01f,  //  -14.85 dB
-    1.81925060e-01f,  //  -14.80 dB
-    1.83033478e-01f,  //  -14.75 dB
-    1.84148650e-01f,  //  -14.70 dB
-    1.85270616e-01f,  //  -14.64 dB
-    1.86399418e-01f,  //  -14.59 dB
-    1.87535098e-01f,  //  -14.54 dB
-    1.88677697e-01f,  //  -14.49 dB
-    1.89827258e-01f,  //  -14.43 dB
-    1.90983822e-01f,  //  -14.38 dB
-    1.92147433e-01f,  //  -14.33 dB
-    1.93318134e-01f,  //  -14.27 dB
-    1.94495967e-01f,  //  -14.22 dB
-    1.95680977e-01f,  //  -14.17 dB
-    1.96873206e-01f,  //  -14.12 dB
-    1.98072700e-01f,  //  -14.06 dB
-    1.99279502e-01f,  //  -14.01 dB
-    2.00493656e-01f,  //  -13.96 dB
-    2.01715208e-01f,  //  -13.91 dB
-    2.02944202e-01f,  //  -13.85 dB
-    2.04180685e-01f,  //  -13.80 dB
-    2.05424700e-01f,  //  -13.75 dB
-    2.06676296e-01f,  //  -13.69 dB
-    2.07935517e-01f,  //  -13.64 dB
-    2.09202410e-01f,  //  -13.59 dB
-    2.10477022e-01f,  //  -13.54 dB
-    2.11759399e-01f,  //  -13.48 dB
-    2.13049590e-01f,  //  -13.43 dB
-    2.14347642e-01f,  //  -13.38 dB
-    2.15653602e-01f,  //  -13.32 dB
-    2.16967520e-01f,  //  -13.27 dB
-    2.18289442e-01f,  //  -13.22 dB
-    2.19619419e-01f,  //  -13.17 dB
-    2.20957498e-01f,  //  -13.11 dB
-    2.22303731e-01f,  //  -13.06 dB
-    2.23658165e-01f,  //  -13.01 dB
-    2.25020852e-01f,  //  -12.96 dB
-    2.26391841e-01f,  //  -12.90 dB
-    2.27771184e-01f,  //  -12.85 dB
-    2.29158930e-01f,  //  -12.80 dB
-    2.30555131e-01f,  //  -12.74 dB
-    2.31959839e-01f,  //  -12.69 dB
-    2.33373106e-01f,  //  -12.64 dB
-    2.34794983e-01f,  //  -12.59 dB
-    2.36225523e-01f,  //  -12.53 dB
-    2.37664779e-01f,  //  -12.48 dB
-    2.39112805e-01f,  //  -12.43 dB
-    2.40569652e-01f,  //  -12.38 dB
-    2.42035376e-01f,  //  -12.32 dB
-    2.43510030e-01f,  //  -12.27 dB
-    2.44993668e-01f,  //  -12.22 dB
-    2.46486346e-01f,  //  -12.16 dB
-    2.47988119e-01f,  //  -12.11 dB
-    2.49499041e-01f,  //  -12.06 dB
-    2.51019169e-01f,  //  -12.01 dB
-    2.52548559e-01f,  //  -11.95 dB
-    2.54087267e-01f,  //  -11.90 dB
-    2.55635350e-01f,  //  -11.85 dB
-    2.57192865e-01f,  //  -11.79 dB
-    2.58759869e-01f,  //  -11.74 dB
-    2.60336420e-01f,  //  -11.69 dB
-    2.61922578e-01f,  //  -11.64 dB
-    2.63518399e-01f,  //  -11.58 dB
-    2.65123943e-01f,  //  -11.53 dB
-    2.66739269e-01f,  //  -11.48 dB
-    2.68364437e-01f,  //  -11.43 dB
-    2.69999506e-01f,  //  -11.37 dB
-    2.71644538e-01f,  //  -11.32 dB
-    2.73299592e-01f,  //  -11.27 dB
-    2.74964730e-01f,  //  -11.21 dB
-    2.76640014e-01f,  //  -11.16 dB
-    2.78325504e-01f,  //  -11.11 dB
-    2.80021264e-01f,  //  -11.06 dB
-    2.81727355e-01f,  //  -11.00 dB
-    2.83443841e-01f,  //  -10.95 dB
-    2.85170785e-01f,  //  -10.90 dB
-    2.86908251e-01f,  //  -10.85 dB
-    2.88656303e-01f,  //  -10.79 dB
-    2.90415006e-01f,  //  -10.74 dB
-    2.92184423e-01f,  //  -10.69 dB
-    2.93964621e-01f,  //  -10.63 dB
-    2.95755666e-01f,  //  -10.58 dB
-    2.97557622e-01f,  //  -10.53 dB
-    2.99370558e-01f,  //  -10.48 dB
-    3.01194539e-01f,  //  -10.42 dB
-    3.03029633e-01f,  //  -10.37 dB
-    3.04875908e-01f,  //  -10.32 dB
-    3.06733432e-01f,  //  -10.26 dB
-    3.08602273e-01f,  //  -10.21 dB
-    3.10482501e-01f,  //  -10.16 dB
-    3.12374184e-01f,  //  -10.11 dB
-    3.14277392e-01f,  //  -10.05 dB
-    3.16192197e-01f,  //  -10.00 dB
-    3.18118668e-01f,  //   -9.95 dB
-    3.20056876e-01f,  //   -9.90 dB
-    3.22006893e-01f,  //   -9.84 dB
-    3.23968791e-01f,  //   -9.79 dB
-    3.25942643e-01f,  //   -9.74 dB
-    3.27928520e-01f,  //   -9.68 dB
-    3.29926497e-01f,  //   -9.63 dB
-    3.31936647e-01f,  //   -9.58 dB
-    3.33959044e-01f,  //   -9.53 dB
-    3.35993764e-01f,  //   -9.47 dB
-    3.38040880e-01f,  //   -9.42 dB
-    3.40100468e-01f,  //   -9.37 dB
-    3.42172606e-01f,  //   -9.32 dB
-    3.44257368e-01f,  //   -9.26 dB
-    3.46354832e-01f,  //   -9.21 dB
-    3.48465075e-01f,  //   -9.16 dB
-    3.50588175e-01f,  //   -9.10 dB
-    3.52724211e-01f,  //   -9.05 dB
-    3.54873262e-01f,  //   -9.00 dB
-    3.57035405e-01f,  //   -8.95 dB
-    3.59210722e-01f,  //   -8.89 dB
-    3.61399293e-01f,  //   -8.84 dB
-    3.63601198e-01f,  //   -8.79 dB
-    3.65816518e-01f,  //   -8.73 dB
-    3.68045336e-01f,  //   -8.68 dB
-    3.70287734e-01f,  //   -8.63 dB
-    3.72543794e-01f,  //   -8.58 dB
-    3.74813599e-01f,  //   -8.52 dB
-    3.77097234e-01f,  //   -8.47 dB
-    3.79394782e-01f,  //   -8.42 dB
-    3.81706328e-01f,  //   -8.37 dB
-    3.84031958e-01f,  //   -8.31 dB
-    3.86371758e-01f,  //   -8.26 dB
-    3.88725813e-01f,  //   -8.21 dB
-    3.91094211e-01f,  //   -8.15 dB
-    3.93477039e-01f,  //   -8.10 dB
-    3.95874384e-01f,  //   -8.05 dB
-    3.98286337e-01f,  //   -8.00 dB
-    4.00712984e-01f,  //   -7.94 dB
-    4.03154416e-01f,  //   -7.89 dB
-    4.05610724e-01f,  //   -7.84 dB
-    4.08081997e-01f,  //   -7.79 dB
-    4.10568326e-01f,  //   -7.73 dB
-    4.13069804e-01f,  //   -7.68 dB
-    4.15586523e-01f,  //   -7.63 dB
-    4.18118576e-01f,  //   -7.57 dB
-    4.20666056e-01f,  //   -7.52 dB
-    4.23229057e-01f,  //   -7.47 dB
-    4.25807673e-01f,  //   -7.42 dB
-    4.28402000e-01f,  //   -7.36 dB
-    4.31012134e-01f,  //   -7.31 dB
-    4.33638171e-01f,  //   -7.26 dB
-    4.36280207e-01f,  //   -7.20 dB
-    4.38938340e-01f,  //   -7.15 dB
-    4.41612669e-01f,  //   -7.10 dB
-    4.44303292e-01f,  //   -7.05 dB
-    4.47010308e-01f,  //   -6.99 dB
-    4.49733817e-01f,  //   -6.94 dB
-    4.52473919e-01f,  //   -6.89 dB
-    4.55230717e-01f,  //   -6.84 dB
-    4.58004310e-01f,  //   -6.78 dB
-    4.60794803e-01f,  //   -6.73 dB
-    4.63602297e-01f,  //   -6.68 dB
-    4.66426896e-01f,  //   -6.62 dB
-    4.69268705e-01f,  //   -6.57 dB
-    4.72127828e-01f,  //   -6.52 dB
-    4.75004371e-01f,  //   -6.47 dB
-    4.77898440e-01f,  //   -6.41 dB
-    4.80810142e-01f,  //   -6.36 dB
-    4.83739584e-01f,  //   -6.31 dB
-    4.86686874e-01f,  //   -6.26 dB
-    4.89652121e-01f,  //   -6.20 dB
-    4.92635435e-01f,  //   -6.15 dB
-    4.95636925e-01f,  //   -6.10 dB
-    4.98656703e-01f,  //   -6.04 dB
-    5.01694879e-01f,  //   -5.99 dB
-    5.04751566e-01f,  //   -5.94 dB
-    5.07826876e-01f,  //   -5.89 dB
-    5.10920923e-01f,  //   -5.83 dB
-    5.14033822e-01f,  //   -5.78 dB
-    5.17165686e-01f,  //   -5.73 dB
-    5.20316633e-01f,  //   -5.67 dB
-    5.23486776e-01f,  //   -5.62 dB
-    5.26676235e-01f,  //   -5.57 dB
-    5.29885127e-01f,  //   -5.52 dB
-    5.33113569e-01f,  //   -5.46 dB
-    5.36361681e-01f,  //   -5.41 dB
-    5.39629583e-01f,  //   -5.36 dB
-    5.42917395e-01f,  //   -5.31 dB
-    5.46225239e-01f,  //   -5.25 dB
-    5.49553237e-01f,  //   -5.20 dB
-    5.52901512e-01f,  //   -5.15 dB
-    5.56270186e-01f,  //   -5.09 dB
-    5.59659385e-01f,  //   -5.04 dB
-    5.63069233e-01f,  //   -4.99 dB
-    5.66499857e-01f,  //   -4.94 dB
-    5.69951382e-01f,  //   -4.88 dB
-    5.73423937e-01f,  //   -4.83 dB
-    5.76917649e-01f,  //   -4.78 dB
-    5.80432647e-01f,  //   -4.72 dB
-    5.83969061e-01f,  //   -4.67 dB
-    5.87527022e-01f,  //   -4.62 dB
-    5.91106660e-01f,  //   -4.57 dB
-    5.94708108e-01f,  //   -4.51 dB
-    5.98331498e-01f,  //   -4.46 dB
-    6.01976965e-01f,  //   -4.41 dB
-    6.05644642e-01f,  //   -4.36 dB
-    6.09334666e-01f,  //   -4.30 dB
-    6.13047172e-01f,  //   -4.25 dB
-    6.16782297e-01f,  //   -4.20 dB
-    6.20540180e-01f,  //   -4.14 dB
-    6.24320958e-01f,  //   -4.09 dB
-    6.28124771e-01f,  //   -4.04 dB
-    6.31951760e-01f,  //   -3.99 dB
-    6.35802066e-01f,  //   -3.93 dB
-    6.39675830e-01f,  //   -3.88 dB
-    6.43573196e-01f,  //   -3.83 dB
-    6.47494308e-01f,  //   -3.78 dB
-    6.51439310e-01f,  //   -3.72 dB
-    6.55408348e-01f,  //   -3.67 dB
-    6.59401568e-01f,  //   -3.62 dB
-    6.63419118e-01f,  //   -3.56 dB
-    6.67461145e-01f,  //   -3.51 dB
-    6.71527800e-01f,  //   -3.46 dB
-    6.75619231e-01f,  //   -3.41 dB
-    6.79735590e-01f,  //   -3.35 dB
-    6.83877029e-01f,  //   -3.30 dB
-    6.88043701e-01f,  //   -3.25 dB
-    6.92235759e-01f,  //   -3.19 dB
-    6.96453359e-01f,  //   -3.14 dB
-    7.00696655e-01f,  //   -3.09 dB
-    7.04965804e-01f,  //   -3.04 dB
-    7.09260963e-01f,  //   -2.98 dB
-    7.13582292e-01f,  //   -2.93 dB
-    7.17929950e-01f,  //   -2.88 dB
-    7.22304097e-01f,  //   -2.83 dB
-    7.26704894e-01f,  //   -2.77 dB
-    7.31132504e-01f,  //   -2.72 dB
-    7.35587090e-01f,  //   -2.67 dB
-    7.40068817e-01f,  //   -2.61 dB
-    7.44577850e-01f,  //   -2.56 dB
-    7.49114355e-01f,  //   -2.51 dB
-    7.53678499e-01f,  //   -2.46 dB
-    7.58270452e-01f,  //   -2.40 dB
-    7.62890382e-01f,  //   -2.35 dB
-    7.67538460e-01f,  //   -2.30 dB
-    7.72214858e-01f,  //   -2.25 dB
-    7.76919747e-01f,  //   -2.19 dB
-    7.81653302e-01f,  //   -2.14 dB
-    7.86415698e-01f,  //   -2.09 dB
-    7.91207109e-01f,  //   -2.03 dB
-    7.96027713e-01f,  //   -1.98 dB
-    8.00877688e-01f,  //   -1.93 dB
-    8.05757212e-01f,  //   -1.88 dB
-    8.10666465e-01f,  //   -1.82 dB
-    8.15605630e-01f,  //   -1.77 dB
-    8.20574887e-01f,  //   -1.72 dB
-    8.25574421e-01f,  //   -1.66 dB
-    8.30604415e-01f,  //   -1.61 dB
-    8.35665056e-01f,  //   -1.56 dB
-    8.40756530e-01f,  //   -1.51 dB
-    8.45879025e-01f,  //   -1.45 dB
-    8.51032730e-01f,  //   -1.40 dB
-    8.56217834e-01f,  //   -1.35 dB
-    8.61434531e-01f,  //   -1.30 dB
-    8.66683011e-01f,  //   -1.24 dB
-    8.71963468e-01f,  //   -1.19 dB
-    8.77276098e-01f,  //   -1.14 dB
-    8.82621097e-01f,  //   -1.08 dB
-    8.87998661e-01f,  //   -1.03 dB
-    8.93408988e-01f,  //   -0.98 dB
-    8.98852280e-01f,  //   -0.93 dB
-    9.04328736e-01f,  //   -0.87 dB
-    9.09838558e-01f,  //   -0.82 dB
-    9.15381951e-01f,  //   -0.77 dB
-    9.20959117e-01f,  //   -0.72 dB
-    9.26570264e-01f,  //   -0.66 dB
-    9.32215598e-01f,  //   -0.61 dB
-    9.37895327e-01f,  //   -0.56 dB
-    9.43609662e-01f,  //   -0.50 dB
-    9.49358812e-01f,  //   -0.45 dB
-    9.55142990e-01f,  //   -0.40 dB
-    9.60962410e-01f,  //   -0.35 dB
-    9.66817285e-01f,  //   -0.29 dB
-    9.72707833e-01f,  //   -0.24 dB
-    9.78634271e-01f,  //   -0.19 dB
-    9.84596816e-01f,  //   -0.13 dB
-    9.90595689e-01f,  //   -0.08 dB
-    9.96631112e-01f,  //   -0.03 dB
-    1.00270331e+00f,  //    0.02 dB
-    1.00881250e+00f,  //    0.08 dB
-    1.01495891e+00f,  //    0.13 dB
-    1.02114277e+00f,  //    0.18 dB
-    1.02736431e+00f,  //    0.23 dB
-    1.03362375e+00f,  //    0.29 dB
-    1.03992134e+00f,  //    0.34 dB
-    1.04625729e+00f,  //    0.39 dB
-    1.05263184e+00f,  //    0.45 dB
-    1.05904523e+00f,  //    0.50 dB
-    1.06549770e+00f,  //    0.55 dB
-    1.07198948e+00f,  //    0.60 dB
-    1.07852081e+00f,  //    0.66 dB
-    1.08509194e+00f,  //    0.71 dB
-    1.09170310e+00f,  //    0.76 dB
-    1.09835454e+00f,  //    0.81 dB
-    1.10504651e+00f,  //    0.87 dB
-    1.11177925e+00f,  //    0.92 dB
-    1.11855301e+00f,  //    0.97 dB
-    1.12536804e+00f,  //    1.03 dB
-    1.13222459e+00f,  //    1.08 dB
-    1.13912292e+00f,  //    1.13 dB
-    1.14606328e+00f,  //    1.18 dB
-    1.15304592e+00f,  //    1.24 dB
-    1.16007111e+00f,  //    1.29 dB
-    1.16713910e+00f,  //    1.34 dB
-    1.17425015e+00f,  //    1.40 dB
-    1.18140453e+00f,  //    1.45 dB
-    1.18860250e+00f,  //    1.50 dB
-    1.19584432e+00f,  //    1.55 dB
-    1.20313027e+00f,  //    1.61 dB
-    1.21046060e+00f,  //    1.66 dB
-    1.21783560e+00f,  //    1.71 dB
-    1.22525554e+00f,  //    1.76 dB
-    1.23272068e+00f,  //    1.82 dB
-    1.24023130e+00f,  //    1.87 dB
-    1.24778768e+00f,  //    1.92 dB
-    1.25539010e+00f,  //    1.98 dB
-    1.26303884e+00f,  //    2.03 dB
-    1.27073419e+00f,  //    2.08 dB
-    1.27847642e+00f,  //    2.13 dB
-    1.28626582e+00f,  //    2.19 dB
-    1.29410267e+00f,  //    2.24 dB
-    1.30198728e+00f,  //    2.29 dB
-    1.30991993e+00f,  //    2.34 dB
-    1.31790090e+00f,  //    2.40 dB
-    1.32593050e+00f,  //    2.45 dB
-    1.33400903e+00f,  //    2.50 dB
-    1.34213677e+00f,  //    2.56 dB
-    1.35031404e+00f,  //    2.61 dB
-    1.35854112e+00f,  //    2.66 dB
-    1.36681834e+00f,  //    2.71 dB
-    1.37514598e+00f,  //    2.77 dB
-    1.38352436e+00f,  //    2.82 dB
-    1.39195379e+00f,  //    2.87 dB
-    1.40043457e+00f,  //    2.93 dB
-    1.40896703e+00f,  //    2.98 dB
-    1.41755147e+00f,  //    3.03 dB
-    1.42618822e+00f,  //    3.08 dB
-    1.43487758e+00f,  //    3.14 dB
-    1.44361989e+00f,  //    3.19 dB
-    1.45241547e+00f,  //    3.24 dB
-    1.46126463e+00f,  //    3.29 dB
-    1.47016770e+00f,  //    3.35 dB
-    1.47912503e+00f,  //    3.40 dB
-    1.48813692e+00f,  //    3.45 dB
-    1.49720372e+00f,  //    3.51 dB
-    1.50632577e+00f,  //    3.56 dB
-    1.51550339e+00f,  //    3.61 dB
-    1.52473693e+00f,  //    3.66 dB
-    1.53402673e+00f,  //    3.72 dB
-    1.54337312e+00f,  //    3.77 dB
-    1.55277646e+00f,  //    3.82 dB
-    1.56223710e+00f,  //    3.87 dB
-    1.57175537e+00f,  //    3.93 dB
-    1.58133164e+00f,  //    3.98 dB
-    1.59096625e+00f,  //    4.03 dB
-    1.60065956e+00f,  //    4.09 dB
-    1.61041194e+00f,  //    4.14 dB
-    1.62022373e+00f,  //    4.19 dB
-    1.63009530e+00f,  //    4.24 dB
-    1.64002701e+00f,  //    4.30 dB
-    1.65001924e+00f,  //    4.35 dB
-    1.66007235e+00f,  //    4.40 dB
-    1.67018670e+00f,  //    4.46 dB
-    1.68036269e+00f,  //    4.51 dB
-    1.69060067e+00f,  //    4.56 dB
-    1.70090102e+00f,  //    4.61 dB
-    1.71126414e+00f,  //    4.67 dB
-    1.72169039e+00f,  //    4.72 dB
-    1.73218017e+00f,  //    4.77 dB
-    1.74273386e+00f,  //    4.82 dB
-    1.75335185e+00f,  //    4.88 dB
-    1.76403454e+00f,  //    4.93 dB
-    1.77478231e+00f,  //    4.98 dB
-    1.78559556e+00f,  //    5.04 dB
-    1.79647469e+00f,  //    5.09 dB
-    1.80742011e+00f,  //    5.14 dB
-    1.81843222e+00f,  //    5.19 dB
-    1.82951142e+00f,  //    5.25 dB
-    1.84065812e+00f,  //    5.30 dB
-    1.85187274e+00f,  //    5.35 dB
-    1.86315568e+00f,  //    5.40 dB
-    1.87450737e+00f,  //    5.46 dB
-    1.88592822e+00f,  //    5.51 dB
-    1.89741865e+00f,  //    5.56 dB
-    1.90897909e+00f,  //    5.62 dB
-    1.92060997e+00f,  //    5.67 dB
-    1.93231171e+00f,  //    5.72 dB
-    1.94408475e+00f,  //    5.77 dB
-    1.95592951e+00f,  //    5.83 dB
-    1.96784645e+00f,  //    5.88 dB
-    1.97983598e+00f,  //    5.93 dB
-    1.99189857e+00f,  //    5.99 dB
-    2.00403465e+00f,  //    6.04 dB
-    2.01624468e+00f,  //    6.09 dB
-    2.02852909e+00f,  //    6.14 dB
-    2.04088836e+00f,  //    6.20 dB
-    2.05332292e+00f,  //    6.25 dB
-    2.06583324e+00f,  //    6.30 dB
-    2.07841979e+00f,  //    6.35 dB
-    2.09108302e+00f,  //    6.41 dB
-    2.10382340e+00f,  //    6.46 dB
-    2.11664141e+00f,  //    6.51 dB
-    2.12953752e+00f,  //    6.57 dB
-    2.14251219e+00f,  //    6.62 dB
-    2.15556592e+00f,  //    6.67 dB
-    2.16869918e+00f,  //    6.72 dB
-    2.18191246e+00f,  //    6.78 dB
-    2.19520625e+00f,  //    6.83 dB
-    2.20858102e+00f,  //    6.88 dB
-    2.22203729e+00f,  //    6.94 dB
-    2.23557555e+00f,  //    6.99 dB
-    2.24919628e+00f,  //    7.04 dB
-    2.26290001e+00f,  //    7.09 dB
-    2.27668723e+00f,  //    7.15 dB
-    2.29055845e+00f,  //    7.20 dB
-    2.30451418e+00f,  //    7.25 dB
-    2.31855494e+00f,  //    7.30 dB
-    2.33268125e+00f,  //    7.36 dB
-    2.34689362e+00f,  //    7.41 dB
-    2.36119259e+00f,  //    7.46 dB
-    2.37557868e+00f,  //    7.52 dB
-    2.39005242e+00f,  //    7.57 dB
-    2.40461434e+00f,  //    7.62 dB
-    2.41926498e+00f,  //    7.67 dB
-    2.43400489e+00f,  //    7.73 dB
-    2.44883460e+00f,  //    7.78 dB
-    2.46375467e+00f,  //    7.83 dB
-    2.47876563e+00f,  //    7.88 dB
-    2.49386806e+00f,  //    7.94 dB
-    2.50906250e+00f,  //    7.99 dB
-    2.52434952e+00f,  //    8.04 dB
-    2.53972968e+00f,  //    8.10 dB
-    2.55520354e+00f,  //    8.15 dB
-    2.57077168e+00f,  //    8.20 dB
-    2.58643468e+00f,  //    8.25 dB
-    2.60219310e+00f,  //    8.31 dB
-    2.61804754e+00f,  //    8.36 dB
-    2.63399857e+00f,  //    8.41 dB
-    2.65004679e+00f,  //    8.47 dB
-    2.66619278e+00f,  //    8.52 dB
-    2.68243715e+00f,  //    8.57 dB
-    2.69878049e+00f,  //    8.62 dB
-    2.71522341e+00f,  //    8.68 dB
-    2.73176651e+00f,  //    8.73 dB
-    2.74841040e+00f,  //    8.78 dB
-    2.76515569e+00f,  //    8.83 dB
-    2.78200302e+00f,  //    8.89 dB
-    2.79895298e+00f,  //    8.94 dB
-    2.81600622e+00f,  //    8.99 dB
-    2.83316336e+00f,  //    9.05 dB
-    2.85042504e+00f,  //    9.10 dB
-    2.86779188e+00f,  //    9.15 dB
-    2.88526453e+00f,  //    9.20 dB
-    2.90284365e+00f,  //    9.26 dB
-    2.92052986e+00f,  //    9.31 dB
-    2.93832384e+00f,  //    9.36 dB
-    2.95622622e+00f,  //    9.41 dB
-    2.97423768e+00f,  //    9.47 dB
-    2.99235888e+00f,  //    9.52 dB
-    3.01059049e+00f,  //    9.57 dB
-    3.02893318e+00f,  //    9.63 dB
-    3.04738762e+00f,  //    9.68 dB
-    3.06595450e+00f,  //    9.73 dB
-    3.08463451e+00f,  //    9.78 dB
-    3.10342832e+00f,  //    9.84 dB
-    3.12233665e+00f,  //    9.89 dB
-    3.14136017e+00f,  //    9.94 dB
-    3.16049960e+00f,  //   10.00 dB
-    3.17975564e+00f,  //   10.05 dB
-    3.19912901e+00f,  //   10.10 dB
-    3.21862041e+00f,  //   10.15 dB
-    3.23823056e+00f,  //   10.21 dB
-    3.25796020e+00f,  //   10.26 dB
-    3.27781004e+00f,  //   10.31 dB
-    3.29778082e+00f,  //   10.36 dB
-    3.31787328e+00f,  //   10.42 dB
-    3.33808815e+00f,  //   10.47 dB
-    3.35842619e+00f,  //   10.52 dB
-    3.37888815e+00f,  //   10.58 dB
-    3.39947477e+00f,  //   10.63 dB
-    3.42018682e+00f,  //   10.68 dB
-    3.44102506e+00f,  //   10.73 dB
-    3.46199027e+00f,  //   10.79 dB
-    3.48308321e+00f,  //   10.84 dB
-    3.50430466e+00f,  //   10.89 dB
-    3.52565541e+00f,  //   10.94 dB
-    3.54713625e+00f,  //   11.00 dB
-    3.56874796e+00f,  //   11.05 dB
-    3.59049134e+00f,  //   11.10 dB
-    3.61236720e+00f,  //   11.16 dB
-    3.63437635e+00f,  //   11.21 dB
-    3.65651959e+00f,  //   11.26 dB
-    3.67879774e+00f,  //   11.31 dB
-    3.70121163e+00f,  //   11.37 dB
-    3.72376208e+00f,  //   11.42 dB
-    3.74644992e+00f,  //   11.47 dB
-    3.76927599e+00f,  //   11.53 dB
-    3.79224114e+00f,  //   11.58 dB
-    3.81534621e+00f,  //   11.63 dB
-    3.83859205e+00f,  //   11.68 dB
-    3.86197951e+00f,  //   11.74 dB
-    3.88550948e+00f,  //   11.79 dB
-    3.90918280e+00f,  //   11.84 dB
-    3.93300036e+00f,  //   11.89 dB
-    3.95696303e+00f,  //   11.95 dB
-    3.98107171e+00f,  //   12.00 dB
-};
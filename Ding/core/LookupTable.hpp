@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+// a function of one variable as a table built at compile time
+//
+// Function has a `static constexpr double evaluate(double)`, usually through
+// ConstexprMath, Domain has `static constexpr double s_min, s_max`
+// Size points span the domain, ends included, x outside of it is clamped
+//
+// Order is the interpolation:
+// - 0: nearest entry
+// - 1: linear, error ~ h^2 f'' / 8
+// - 3: cubic Lagrange over the 4 closest entries, error ~ h^4 f'''' / 128,
+//   for when a linear table would need to be huge
+//
+// the table is constant initialized, no code runs at load time, and lookups
+// have no branch besides the clamp
+template <typename Function, typename Domain, std::size_t Size, int Order = 1>
+class LookupTable {
+    static_assert(Order == 0 || Order == 1 || Order == 3);
+    static_assert(Size >= 2);
+    static_assert(Domain::s_min < Domain::s_max);
+
+   public:
+    static constexpr std::size_t s_size = Size;
+    static constexpr int s_order = Order;
+
+    static float evaluate(float x)
+    {
+        const float u =
+            (std::clamp(x, s_min, s_max) - s_min) * s_invStep;
+
+        if constexpr (Order == 0) {
+            return s_data[static_cast<std::size_t>(u + 0.5f) + s_guard];
+        }
+
+        // int, a float to size_t conversion is a branch on x86
+        const int i = std::min(static_cast<int>(u), s_lastStart);
+        const float f = u - static_cast<float>(i);
+        const float* p = s_data.data() + s_guard + i;
+
+        if constexpr (Order == 1) {
+            return p[0] + f * (p[1] - p[0]);
+        } else {
+            // Lagrange cubic through -1, 0, 1, 2, in Horner form
+            const float c1 = p[1] - (1.0f / 3.0f) * p[-1] - 0.5f * p[0] -
+                             (1.0f / 6.0f) * p[2];
+            const float c2 = 0.5f * (p[-1] + p[1]) - p[0];
+            const float c3 =
+                (1.0f / 6.0f) * (p[2] - p[-1]) + 0.5f * (p[0] - p[1]);
+            return ((c3 * f + c2) * f + c1) * f + p[0];
+        }
+    }
+
+   private:
+    static constexpr float s_min = static_cast<float>(Domain::s_min);
+    static constexpr float s_max = static_cast<float>(Domain::s_max);
+    static constexpr double s_step =
+        (Domain::s_max - Domain::s_min) / static_cast<double>(Size - 1);
+    static constexpr float s_invStep = static_cast<float>(1.0 / s_step);
+    // last entry an interpolation can start from
+    static constexpr int s_lastStart = static_cast<int>(Size) - 2;
+
+    // the cubic reads one entry before and two after, the function is
+    // evaluated a step outside the domain for those
+    static constexpr std::size_t s_guard = 1;
+
+    static constexpr std::array<float, Size + 2> tabulate()
+    {
+        std::array<float, Size + 2> table{};
+        for (std::size_t k = 0; k < table.size(); ++k) {
+            const double x =
+                Domain::s_min +
+                (static_cast<double>(k) - static_cast<double>(s_guard)) *
+                    s_step;
+            table[k] = static_cast<float>(Function::evaluate(x));
+        }
+        return table;
+    }
+
+    // constant initialized from tabulate()
+    alignas(64) static const std::array<float, Size + 2> s_data;
+};
+
+template <typename Function, typename Domain, std::size_t Size, int Order>
+alignas(64) const std::array<float, Size + 2>
+    LookupTable<Function, Domain, Size, Order>::s_data =
+        LookupTable<Function, Domain, Size, Order>::tabulate();
+
+// [Min, Max] for the common case of a whole domain
+template <int Min, int Max>
+struct IntegerDomain {
+    static constexpr double s_min = Min;
+    static constexpr double s_max = Max;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "ConstexprMath.hpp"
+#include "LookupTable.hpp"
+
+// the LookupTable instances of the synth
+//
+// see bench/LookupBench.cpp for their error and cost against libm, only use
+// them where that error is fine
+// dB to gain is DecibelLookup, it has its own below range and batch rules
+namespace Lookups {
+
+namespace Functions {
+
+struct MidiToHz {
+    static constexpr double evaluate(double note)
+    {
+        return 440.0 * ConstexprMath::exp2((note - 69.0) / 12.0);
+    }
+};
+
+struct SemitonesToRatio {
+    static constexpr double evaluate(double semitones)
+    {
+        return ConstexprMath::exp2(semitones / 12.0);
+    }
+};
+
+struct Exp {
+    static constexpr double evaluate(double x) { return ConstexprMath::exp(x); }
+};
+
+// the soft knee of NoteTable, t in [0, 1] spans the knee to the hard cut
+struct HfRolloff {
+    static constexpr double evaluate(double t)
+    {
+        return ConstexprMath::exp(-3.0 * t);
+    }
+};
+
+struct Log2 {
+    static constexpr double evaluate(double x)
+    {
+        return ConstexprMath::log2(x);
+    }
+};
+
+// the left gain of Pan.hpp, sqrt(2) cos((p + 1) pi / 4)
+struct PanGain {
+    static constexpr double evaluate(double position)
+    {
+        constexpr double sqrt2 = 1.414213562373095048802;
+        return sqrt2 *
+               ConstexprMath::cos((position + 1.0) * ConstexprMath::s_pi / 4.0);
+    }
+};
+
+}  // namespace Functions
+
+// per sample log of a decay coefficient, e^x is the coefficient
+// -1/32 is 100ms to -30dB at 11kHz, nothing decays faster than that
+struct LogDecayDomain {
+    static constexpr double s_min = -1.0 / 32.0;
+    static constexpr double s_max = 0.0;
+};
+
+// frexp mantissas
+struct MantissaDomain {
+    static constexpr double s_min = 0.5;
+    static constexpr double s_max = 1.0;
+};
+
+// fractional notes included, for bent pitches
+using MidiToHz =
+    LookupTable<Functions::MidiToHz, IntegerDomain<0, 127>, 512, 3>;
+
+// a full MPE bend on top of a master bend, either way
+// linear: a cubic costs more than exp2f, 2048 entries are within 0.01 cent
+using SemitonesToRatio =
+    LookupTable<Functions::SemitonesToRatio, IntegerDomain<-96, 96>, 2048, 1>;
+
+// per sample decay coefficients, see Decay.hpp
+using ExpDecay = LookupTable<Functions::Exp, LogDecayDomain, 1024, 1>;
+
+using HfRolloff =
+    LookupTable<Functions::HfRolloff, IntegerDomain<0, 1>, 256, 1>;
+
+using Log2Mantissa = LookupTable<Functions::Log2, MantissaDomain, 1024, 1>;
+
+// pan positions, the right gain is the left one at -position
+// 1024 entries keep L^2 + R^2 within 1e-6 of 2
+using PanGain = LookupTable<Functions::PanGain, IntegerDomain<-1, 1>, 1024, 1>;
+
+// what gainToDb returns for silence
+static constexpr float s_silenceDb = -200.0f;
+
+// 20 log10(gain) for metering
+// gain = m 2^e with m in [0.5, 1), e and m are read straight from the float
+// bits, only log2(m) comes from a table
+// subnormal gains come out as silence
+inline float gainToDb(const float gain)
+{
+    if (!(gain >= std::numeric_limits<float>::min())) {
+        return s_silenceDb;
+    }
+
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &gain, sizeof(bits));
+    // biased exponent of [0.5, 1) is 126
+    const int exponent = static_cast<int>((bits >> 23) & 0xffu) - 126;
+    bits = (bits & 0x807fffffu) | (126u << 23);
+    float mantissa = 0.0f;
+    std::memcpy(&mantissa, &bits, sizeof(mantissa));
+
+    const float log2Gain =
+        static_cast<float>(exponent) + Log2Mantissa::evaluate(mantissa);
+
+    // 20 log10(2)
+    constexpr float dbPerOctave = 6.02059991f;
+    return std::max(log2Gain * dbPerOctave, s_silenceDb);
+}
+
+}  // namespace Lookups
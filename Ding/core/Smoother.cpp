@@ -0,0 +1,109 @@
+#include "Smoother.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "VectorOps.hpp"
+
+void Smoother::prepare(const double sampleRate,
+                       const int maxBlockSize,
+                       const float smoothingTime)
+{
+    m_coefficient = static_cast<float>(
+        std::exp(-1.0 / (static_cast<double>(smoothingTime) * sampleRate)));
+
+    float power = 1.0f;
+    for (std::size_t j = 0; j < Register::size(); ++j) {
+        power *= m_coefficient;
+        m_powers.set(j, power);
+    }
+    m_registerStep = power;
+    m_skipLength = -1;
+
+    const std::size_t nSamples =
+        static_cast<std::size_t>(std::max(maxBlockSize, 1));
+    m_ramp.resize((nSamples + Register::size() - 1) / Register::size());
+}
+
+void Smoother::reset(const float value)
+{
+    m_current = value;
+    m_target = value;
+}
+
+template <typename Sample>
+void Smoother::applyGain(juce::AudioBuffer<Sample>& buffer,
+                         const int startSample,
+                         const int numSamples)
+{
+    const int channels = buffer.getNumChannels();
+
+    if (isSettled()) {
+        if (m_current != 1.0f) {
+            for (int ch = 0; ch < channels; ++ch) {
+                juce::FloatVectorOperations::multiply(
+                    buffer.getWritePointer(ch, startSample),
+                    static_cast<Sample>(m_current), numSamples);
+            }
+        }
+        return;
+    }
+
+    // hosts are allowed to send blocks larger than announced
+    const int chunkSize = static_cast<int>(m_ramp.size() * Register::size());
+    for (int done = 0; done < numSamples; done += chunkSize) {
+        const int n = std::min(chunkSize, numSamples - done);
+        fillRamp(n);
+
+        const auto* ramp = reinterpret_cast<const float*>(m_ramp.data());
+        for (int ch = 0; ch < channels; ++ch) {
+            VectorOps::multiply(buffer.getWritePointer(ch, startSample + done),
+                                ramp, n);
+        }
+    }
+}
+
+template void Smoother::applyGain(juce::AudioBuffer<float>&, int, int);
+template void Smoother::applyGain(juce::AudioBuffer<double>&, int, int);
+
+float Smoother::skip(const int numSamples)
+{
+    if (isSettled()) {
+        return m_current;
+    }
+
+    if (numSamples != m_skipLength) {
+        m_skipLength = numSamples;
+        m_skipStep = std::pow(m_coefficient, static_cast<float>(numSamples));
+    }
+
+    m_current = m_target + m_skipStep * (m_current - m_target);
+    settle();
+    return m_current;
+}
+
+void Smoother::fillRamp(const int numSamples)
+{
+    const Register target(m_target);
+    float distance = m_current - m_target;
+
+    const auto nRegisters =
+        (static_cast<std::size_t>(numSamples) + Register::size() - 1) /
+        Register::size();
+    for (std::size_t r = 0; r < nRegisters; ++r) {
+        m_ramp[r] = Register::multiplyAdd(target, m_powers, Register(distance));
+        distance *= m_registerStep;
+    }
+
+    // the last register may be partial
+    const auto* ramp = reinterpret_cast<const float*>(m_ramp.data());
+    m_current = ramp[numSamples - 1];
+    settle();
+}
+
+void Smoother::settle()
+{
+    if (std::abs(m_current - m_target) < s_epsilon) {
+        m_current = m_target;
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+// one-pole smoothing of a continuous parameter, computed a block at a time
+//
+// v[n] = target + k (v[n-1] - target)
+// ie v[n] = target + k^n (v[0] - target)
+//
+// the recurrence is serial but its closed form isn't: a register of W samples
+// is target + (k^1 .. k^W) * (v - target), and the next register is k^W
+// further down
+//
+// once within s_epsilon of the target the smoother is settled and snaps to
+// it, a settled gain is a plain vector multiply and a settled gain of 1 costs
+// nothing
+class Smoother {
+   public:
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    static constexpr float s_epsilon = 1e-5f;
+
+    // smoothingTime is the time constant, in seconds
+    // allocates the ramp scratch, call this off the audio thread
+    void prepare(double sampleRate, int maxBlockSize, float smoothingTime);
+
+    // jumps to value, no ramp
+    void reset(float value);
+    void setTarget(float target) { m_target = target; }
+
+    float current() const { return m_current; }
+    bool isSettled() const { return m_current == m_target; }
+
+    // multiplies samples [startSample, startSample + numSamples) of every
+    // channel by the smoothed value
+    // the ramp is float whatever the buffer, a gain needs no more
+    template <typename Sample>
+    void applyGain(juce::AudioBuffer<Sample>& buffer,
+                   int startSample,
+                   int numSamples);
+
+    // control rate: moves numSamples samples forward and returns the value
+    // reached, for parameters that only get updated once per block
+    float skip(int numSamples);
+
+   private:
+    // writes the next numSamples values to m_ramp, numSamples must fit in it
+    void fillRamp(int numSamples);
+    void settle();
+
+    float m_coefficient = 0.0f;
+    float m_current = 1.0f;
+    float m_target = 1.0f;
+
+    // lane j is k^(j + 1)
+    Register m_powers = Register(0.0f);
+    // k^W
+    float m_registerStep = 0.0f;
+
+    // k^n for the last n skip() was called with, hosts rarely change it
+    int m_skipLength = -1;
+    float m_skipStep = 0.0f;
+
+    std::vector<Register> m_ramp;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+// hands whole snapshots over to the audio thread
+//
+// a snapshot is built off the audio thread, the audio thread adopts the
+// latest one at the top of a block: one pointer swap and a copy, no lock, no
+// allocation, nothing computed, never half a snapshot
+// one published before the previous one was adopted replaces it
+//
+// the message thread copies a snapshot into a slot of the exchange, the audio
+// thread marks the slot it copies out of, and the message thread never writes
+// a slot that is pending or marked: with three slots there always is a free
+// one, nobody ever waits
+template <typename T>
+class SnapshotExchange {
+   public:
+    // message thread only, one writer
+    void publish(const T& snapshot)
+    {
+        T* slot = freeSlot();
+        *slot = snapshot;
+        m_pending.store(slot);
+    }
+
+    // audio thread, copies the latest snapshot into out
+    // false if nothing was published since the last call
+    bool adopt(T& out)
+    {
+        const T* pending = m_pending.load();
+        if (pending == nullptr) {
+            return false;
+        }
+
+        // marked before it's taken, a writer that still saw it pending
+        // after that sees the mark
+        m_reading.store(pending);
+        const bool taken = m_pending.compare_exchange_strong(pending, nullptr);
+        // otherwise replaced in between, the next block gets the new one
+        if (taken) {
+            out = *pending;
+        }
+        m_reading.store(nullptr);
+        return taken;
+    }
+
+    // drops what is pending, only while the audio thread is stopped
+    void clear() { m_pending.store(nullptr); }
+
+   private:
+    T* freeSlot()
+    {
+        const T* pending = m_pending.load();
+        const T* reading = m_reading.load();
+        for (T& slot : m_slots) {
+            if (&slot != pending && &slot != reading) {
+                return &slot;
+            }
+        }
+        // unreachable, at most two of the three are taken
+        return &m_slots[0];
+    }
+
+    std::array<T, 3> m_slots{};
+    std::atomic<const T*> m_pending{nullptr};
+    std::atomic<const T*> m_reading{nullptr};
+};
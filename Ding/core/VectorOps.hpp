@@ -0,0 +1,59 @@
+#pragma once
+
+#include <type_traits>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+// FloatVectorOperations across precisions
+//
+// the synth renders float wherever double buys nothing, a double buffer
+// takes those float samples as it accumulates them, no conversion copy in
+// between
+// same precision on both sides goes straight to FloatVectorOperations, the
+// mixed loops are simple enough for the compiler to vectorize
+namespace VectorOps {
+
+// dest[i] += src[i]
+template <typename Dest, typename Src>
+void add(Dest* dest, const Src* src, const int numSamples)
+{
+    if constexpr (std::is_same_v<Dest, Src>) {
+        juce::FloatVectorOperations::add(dest, src, numSamples);
+    } else {
+        for (int i = 0; i < numSamples; ++i) {
+            dest[i] += static_cast<Dest>(src[i]);
+        }
+    }
+}
+
+// dest[i] += src[i] * gain
+template <typename Dest, typename Src>
+void addWithMultiply(Dest* dest,
+                     const Src* src,
+                     const Dest gain,
+                     const int numSamples)
+{
+    if constexpr (std::is_same_v<Dest, Src>) {
+        juce::FloatVectorOperations::addWithMultiply(dest, src, gain,
+                                                     numSamples);
+    } else {
+        for (int i = 0; i < numSamples; ++i) {
+            dest[i] += static_cast<Dest>(src[i]) * gain;
+        }
+    }
+}
+
+// dest[i] *= src[i]
+template <typename Dest, typename Src>
+void multiply(Dest* dest, const Src* src, const int numSamples)
+{
+    if constexpr (std::is_same_v<Dest, Src>) {
+        juce::FloatVectorOperations::multiply(dest, src, numSamples);
+    } else {
+        for (int i = 0; i < numSamples; ++i) {
+            dest[i] *= static_cast<Dest>(src[i]);
+        }
+    }
+}
+
+}  // namespace VectorOps
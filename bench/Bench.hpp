@@ -0,0 +1,71 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+// minimal timing harness, no dependency besides the code under test
+namespace bench {
+
+// keeps the optimizer from throwing the measured work away
+inline volatile float sink = 0.0f;
+
+// set by any failed check, main returns non zero
+inline bool failed = false;
+
+// best of nRuns, in ns per item
+// f(nItems) must process nItems items
+template <typename F>
+double nsPerItem(F&& f, const std::size_t nItems, const int nRuns = 7)
+{
+    using Clock = std::chrono::steady_clock;
+
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < nRuns; ++run) {
+        const auto start = Clock::now();
+        f(nItems);
+        const auto stop = Clock::now();
+
+        const double ns =
+            std::chrono::duration<double, std::nano>(stop - start).count();
+        best = std::min(best, ns / static_cast<double>(nItems));
+    }
+    return best;
+}
+
+inline void header(const char* title)
+{
+    std::printf("\n== %s\n", title);
+}
+
+inline void report(const char* name, const double ns, const char* unit)
+{
+    std::printf("  %-40s %8.3f ns/%s\n", name, ns, unit);
+}
+
+// for the benches that double as regression checks
+inline void check(const bool ok, const char* what)
+{
+    std::printf("  %-40s %s\n", what, ok ? "ok" : "FAILED");
+    failed = failed || !ok;
+}
+
+}  // namespace bench
+
+// one entry point per bench file, see main.cpp
+void runOscillatorBench();
+void runOscillatorPolicyBench();
+void runDenormalBench();
+void runMpeBench();
+void runGlideBench();
+void runDecibelBench();
+void runLookupBench();
+void runVoiceBench();
+void runEventBench();
+void runThreadBench();
+void runPanBench();
+void runPrecisionBench();
+void runPresetBench();
+void runModelBench();
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "core/DecibelLookup.hpp"
+
+// dB to gain: libm vs the scalar lookup vs the batch one
+namespace {
+constexpr std::size_t nValues = 1 << 16;
+
+// a bit past both ends of the table so the clamping is exercised
+std::vector<float> decibels()
+{
+    std::vector<float> db(nValues);
+    for (std::size_t i = 0; i < nValues; ++i) {
+        db[i] = -100.0f + 116.0f * static_cast<float>(i) /
+                              static_cast<float>(nValues - 1);
+    }
+    return db;
+}
+
+void accuracy(const std::vector<float>& db)
+{
+    std::vector<float> batch(db.size());
+    DecibelLookup::fromDb(db.data(), batch.data(), db.size());
+
+    double maxError = 0.0;
+    float maxMismatch = 0.0f;
+    for (std::size_t i = 0; i < db.size(); ++i) {
+        const float scalar = DecibelLookup::fromDb(db[i]);
+        // the batch path fuses the lerp, it may round differently
+        maxMismatch =
+            std::max(maxMismatch, std::abs(batch[i] - scalar) /
+                                      std::max(scalar, 1e-30f));
+
+        if (db[i] >= -96.0f && db[i] <= 12.0f) {
+            const double exact = std::pow(10.0, db[i] / 20.0);
+            maxError = std::max(maxError, std::abs(scalar / exact - 1.0));
+        }
+    }
+
+    std::printf("  %-40s %8.2e\n", "max relative error vs libm", maxError);
+    bench::check(maxError < 1e-5, "table within 1e-5 of libm");
+    bench::check(maxMismatch < 1e-6f, "batch matches scalar");
+    bench::check(DecibelLookup::fromDb(-100.0f) == 0.0f && batch[0] == 0.0f,
+                 "below range is silence");
+}
+
+void timings(const std::vector<float>& db)
+{
+    std::vector<float> out(db.size());
+
+    const double libm = bench::nsPerItem(
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = std::pow(10.0f, db[i] * 0.05f);
+            }
+            bench::sink = out[n / 2];
+        },
+        db.size());
+    bench::report("std::pow", libm, "value");
+
+    const double scalar = bench::nsPerItem(
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = DecibelLookup::fromDb(db[i]);
+            }
+            bench::sink = out[n / 2];
+        },
+        db.size());
+    bench::report("DecibelLookup::fromDb(float)", scalar, "value");
+
+    const double batch = bench::nsPerItem(
+        [&](std::size_t n) {
+            DecibelLookup::fromDb(db.data(), out.data(), n);
+            bench::sink = out[n / 2];
+        },
+        db.size());
+    bench::report("DecibelLookup::fromDb(in, out, n)", batch, "value");
+}
+}  // namespace
+
+void runDecibelBench()
+{
+    const std::vector<float> db = decibels();
+
+    bench::header("decibel: -100dB to +16dB");
+    accuracy(db);
+    timings(db);
+}
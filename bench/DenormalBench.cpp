@@ -0,0 +1,162 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "Bench.hpp"
+#include "Synth/DampedModeOscillator.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/ModalBank.hpp"
+#include "Synth/ResonatorBank.hpp"
+
+// none of this installs juce::ScopedNoDenormals: the kernels must not produce
+// subnormals on their own, whatever the FTZ/DAZ state of the thread
+namespace {
+constexpr double sampleRate = 48000.0;
+
+// a mode losing 6dB per sample goes subnormal after ~130 samples
+constexpr float fastDecay = 0.5f;
+constexpr std::size_t kernelSamples = 4096;
+
+bool isSubnormal(const float x)
+{
+    return std::fpclassify(x) == FP_SUBNORMAL;
+}
+
+void modalBankTick()
+{
+    ModalBank<1> bank;
+    bank.addMode(0, 0.1f, 1.0f, fastDecay);
+
+    bool ok = true;
+    for (std::size_t n = 0; n < kernelSamples; ++n) {
+        bench::sink = bank.tick();
+        if ((n + 1) % Denormals::s_snapInterval == 0) {
+            bank.snapToZero();
+        }
+        ok = ok && !isSubnormal(bank.amplitude());
+    }
+    bench::check(ok && bank.amplitude() == 0.0f, "ModalBank::tick");
+}
+
+void modalBankTimeAxis()
+{
+    ModalBank<1> bank;
+    bank.addMode(0, 0.1f, 1.0f, fastDecay);
+    bank.prepareTimeAxis(1.0f);
+
+    alignas(64) std::array<float, 64> out{};
+
+    bool ok = true;
+    for (std::size_t n = 0; n < kernelSamples; n += out.size()) {
+        bank.renderTimeAxis(out.data(), static_cast<int>(out.size()));
+        for (const float x : out) {
+            ok = ok && !isSubnormal(x);
+        }
+        ok = ok && !isSubnormal(bank.amplitude());
+    }
+    bench::check(ok && bank.amplitude() == 0.0f, "ModalBank::renderTimeAxis");
+}
+
+void dampedMode()
+{
+    DampedModeOscillator osc;
+    osc.setSampleRate(sampleRate);
+    osc.setFrequency(440.0f);
+    osc.setDecay(fastDecay);
+    osc.reset(1.0f);
+
+    bool ok = true;
+    for (std::size_t n = 0; n < kernelSamples; ++n) {
+        osc.advance();
+        if ((n + 1) % Denormals::s_snapInterval == 0) {
+            osc.snapToZero();
+        }
+        ok = ok && !isSubnormal(osc.m_cosv) && !isSubnormal(osc.m_sinv);
+    }
+    bench::check(ok && osc.level() == 0.0f, "DampedModeOscillator");
+}
+
+void resonator()
+{
+    ResonatorBank<1> bank;
+    bank.setMode(0, 0.1f, fastDecay, 1.0f);
+    bank.prepare(1.0f);
+    bank.strike({1.0f});
+
+    bool ok = true;
+    for (std::size_t n = 0; n < kernelSamples; ++n) {
+        bench::sink = bank.tick();
+        if ((n + 1) % Denormals::s_snapInterval == 0) {
+            bank.snapToZero();
+        }
+        ok = ok && !isSubnormal(bank.amplitude());
+    }
+    bench::check(ok && bank.amplitude() == 0.0f, "ResonatorBank");
+}
+
+// a few notes, then a long tail in host sized blocks
+void synthTail(const RenderEngine engine, const char* name)
+{
+    constexpr int blockSize = 512;
+    constexpr int attackBlocks = 100;
+    constexpr int tailBlocks = 20 * 48000 / blockSize;
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    std::size_t subnormals = 0;
+    const auto countSubnormals = [&]() {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+            for (int i = 0; i < blockSize; ++i) {
+                subnormals += isSubnormal(buffer.getSample(ch, i)) ? 1 : 0;
+            }
+        }
+    };
+
+    for (int b = 0; b < attackBlocks; ++b) {
+        juce::MidiBuffer midi;
+        if (b % 10 == 0) {
+            const int note = 72 + b / 10;
+            midi.addEvent(juce::MidiMessage::noteOn(1, note, 0.8f), 0);
+            midi.addEvent(juce::MidiMessage::noteOff(1, note), blockSize / 2);
+        }
+        buffer.clear();
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+        countSubnormals();
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const juce::MidiBuffer noMidi;
+    double ns = 0.0;
+    for (int b = 0; b < tailBlocks; ++b) {
+        buffer.clear();
+        const auto start = Clock::now();
+        synth.renderNextBlock(buffer, noMidi, 0, blockSize);
+        ns += std::chrono::duration<double, std::nano>(Clock::now() - start)
+                  .count();
+        countSubnormals();
+    }
+
+    bench::report(name, ns / (tailBlocks * blockSize), "sample");
+    bench::check(subnormals == 0, name);
+}
+}  // namespace
+
+void runDenormalBench()
+{
+    bench::header("denormals: kernels never leave a subnormal behind");
+    modalBankTick();
+    modalBankTimeAxis();
+    dampedMode();
+    resonator();
+
+    bench::header("denormals: 20 s tail, no FTZ/DAZ");
+    synthTail(RenderEngine::perVoice, "per voice");
+    synthTail(RenderEngine::arena, "arena");
+    synthTail(RenderEngine::timeAxis, "time axis");
+    synthTail(RenderEngine::damped, "damped");
+    synthTail(RenderEngine::resonator, "resonator");
+}
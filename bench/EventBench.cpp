@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/DingSynth.hpp"
+
+// sample accurate MIDI: a note starts on its sample wherever it falls in the
+// block, and dense MIDI doesn't cut the block in pieces
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 256;
+
+// a note at offset p sounds like the same note at offset 0, p samples later
+void startsOnItsSample(const RenderEngine engine, const char* name)
+{
+    constexpr int length = 4 * blockSize;
+    constexpr int offset = 37;
+
+    const auto renderNote = [&](const int position) {
+        DingSynth synth;
+        synth.prepare(sampleRate, blockSize);
+        synth.setEngine(engine);
+
+        juce::AudioBuffer<float> buffer(1, length);
+        buffer.clear();
+        for (int start = 0; start < length; start += blockSize) {
+            juce::MidiBuffer midi;
+            if (start == 0) {
+                midi.addEvent(juce::MidiMessage::noteOn(1, 69, 0.8f),
+                              position);
+            }
+            synth.renderNextBlock(buffer, midi, start, blockSize);
+        }
+        return std::vector<float>(buffer.getReadPointer(0),
+                                  buffer.getReadPointer(0) + length);
+    };
+
+    const std::vector<float> early = renderNote(0);
+    const std::vector<float> late = renderNote(offset);
+
+    float peak = 0.0f;
+    float error = 0.0f;
+    for (int i = 0; i < offset; ++i) {
+        error = std::max(error, std::abs(late[i]));
+    }
+    for (int i = offset; i < length; ++i) {
+        peak = std::max(peak, std::abs(early[i - offset]));
+        error = std::max(error, std::abs(late[i] - early[i - offset]));
+    }
+    bench::check(peak > 0.0f && error < 1e-4f * peak, name);
+}
+
+// a block with more events than the pool holds: a ringing note struck
+// again until the pool is full, then a new note, which must still sound
+void poolOverflow(const RenderEngine engine, const char* name)
+{
+    constexpr int nRestrikes = 256;
+    constexpr int newNoteAt = 200;
+
+    const auto render = [&](const bool newNote) {
+        DingSynth synth;
+        synth.prepare(sampleRate, blockSize);
+        synth.setEngine(engine);
+
+        juce::AudioBuffer<float> buffer(1, 2 * blockSize);
+        buffer.clear();
+        juce::MidiBuffer midi;
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60, 0.8f), 0);
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+        midi.clear();
+        for (int e = 0; e < nRestrikes; ++e) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 60, 0.1f),
+                          blockSize + e * newNoteAt / nRestrikes);
+        }
+        if (newNote) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 84, 1.0f),
+                          blockSize + newNoteAt);
+        }
+        synth.renderNextBlock(buffer, midi, blockSize, blockSize);
+        return std::vector<float>(buffer.getReadPointer(0),
+                                  buffer.getReadPointer(0) + 2 * blockSize);
+    };
+
+    const std::vector<float> without = render(false);
+    const std::vector<float> with = render(true);
+
+    constexpr std::size_t from = blockSize + newNoteAt;
+    bool same = true;
+    float difference = 0.0f;
+    for (std::size_t i = 0; i < with.size(); ++i) {
+        if (i < from) {
+            same = same && with[i] == without[i];
+        } else {
+            difference = std::max(difference, std::abs(with[i] - without[i]));
+        }
+    }
+    bench::check(same && difference > 1e-3f, name);
+}
+
+// 16 ringing notes struck again nEvents times per block, spread over the
+// block, so the polyphony stays the same whatever the density
+// split: the block is rendered piece by piece between events, what
+// juce::Synthesiser did
+double eventCost(const RenderEngine engine,
+                 const int nEvents,
+                 const bool split)
+{
+    constexpr int nNotes = 16;
+    constexpr int nBlocks = 48000 * 2 / blockSize;
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+
+    juce::MidiBuffer midi;
+    for (int i = 0; i < nNotes; ++i) {
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60 + i, 0.8f), 0);
+    }
+    buffer.clear();
+    synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+    midi.clear();
+    for (int e = 0; e < nEvents; ++e) {
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60 + e % nNotes, 0.5f),
+                      e * blockSize / nEvents);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    double ns = 0.0;
+    for (int b = 0; b < nBlocks; ++b) {
+        buffer.clear();
+        const auto start = Clock::now();
+        if (split) {
+            int done = 0;
+            for (int e = 1; e <= nEvents; ++e) {
+                const int next = e * blockSize / nEvents;
+                if (next > done) {
+                    synth.renderNextBlock(buffer, midi, done, next - done);
+                    done = next;
+                }
+            }
+            if (done < blockSize) {
+                synth.renderNextBlock(buffer, midi, done, blockSize - done);
+            }
+        } else {
+            synth.renderNextBlock(buffer, midi, 0, blockSize);
+        }
+        ns += std::chrono::duration<double, std::nano>(Clock::now() - start)
+                  .count();
+        bench::sink = buffer.getSample(0, 0);
+    }
+    return ns / (nBlocks * blockSize);
+}
+
+void eventCost(const RenderEngine engine, const char* name)
+{
+    for (const int nEvents : {0, 1, 4, 16, 64}) {
+        std::printf("  %-10s %2d events %-17s %8.3f -> %8.3f ns/sample\n",
+                    name, nEvents, "split -> whole",
+                    eventCost(engine, nEvents, true),
+                    eventCost(engine, nEvents, false));
+    }
+}
+}  // namespace
+
+void runEventBench()
+{
+    bench::header("events: a note starts on its sample");
+    startsOnItsSample(RenderEngine::perVoice, "per voice");
+    startsOnItsSample(RenderEngine::arena, "arena");
+    startsOnItsSample(RenderEngine::timeAxis, "time axis");
+    startsOnItsSample(RenderEngine::damped, "damped");
+    startsOnItsSample(RenderEngine::resonator, "resonator");
+
+    bench::header("events: a note past a full event pool sounds");
+    poolOverflow(RenderEngine::perVoice, "per voice");
+    poolOverflow(RenderEngine::arena, "arena");
+    poolOverflow(RenderEngine::timeAxis, "time axis");
+    poolOverflow(RenderEngine::damped, "damped");
+    poolOverflow(RenderEngine::resonator, "resonator");
+
+    bench::header("events: 16 notes, restrikes per 256 sample block");
+    eventCost(RenderEngine::perVoice, "per voice");
+    eventCost(RenderEngine::arena, "arena");
+    eventCost(RenderEngine::damped, "damped");
+}
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/Glide.hpp"
+#include "Synth/ModalBank.hpp"
+
+// cost of the pitch glide kernel against the static one, and whether it
+// actually plays the pitch it claims to
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr std::size_t nSamples = 1 << 20;
+
+float phaseIncrement(const double freq)
+{
+    return static_cast<float>(juce::MathConstants<double>::twoPi * freq /
+                              sampleRate);
+}
+
+// constant level, so a constant deviation: the output must be a sine at
+// (1 + depth) times the frequency
+void pitch()
+{
+    const float depth = Glide::depth(Glide::s_maxCents);
+    const float inc = phaseIncrement(440.0);
+
+    ModalBank<1> bank;
+    bank.addMode(0, inc, 1.0f, 1.0f);
+
+    const double glidingInc =
+        static_cast<double>(inc) * (1.0 + static_cast<double>(depth));
+
+    float error = 0.0f;
+    for (std::size_t n = 0; n < static_cast<std::size_t>(sampleRate); ++n) {
+        const float expected =
+            static_cast<float>(std::sin(static_cast<double>(n) * glidingInc));
+        error = std::max(error, std::abs(bank.tickGliding(depth) - expected));
+        if ((n & 255) == 255) {
+            bank.renormalize();
+        }
+    }
+
+    bench::check(error < 1e-3f, "+50 cents at full amplitude, 1 s");
+}
+
+template <std::size_t NLive>
+void kernel()
+{
+    // no decay, nothing goes subnormal and skews the timings
+    ModalBank<s_maxModes> bank;
+    for (std::size_t i = 0; i < NLive; ++i) {
+        bank.addMode(i, phaseIncrement(440.0 * static_cast<double>(i + 1)),
+                     1.0f / static_cast<float>(i + 1), 1.0f);
+    }
+
+    const auto run = [&](const bool gliding) {
+        return bench::nsPerItem(
+            [&](std::size_t n) {
+                float acc = 0.0f;
+                for (std::size_t s = 0; s < n; ++s) {
+                    acc += gliding ? bank.tickGliding(0.01f) : bank.tick();
+                    if ((s & 255) == 255) {
+                        bank.renormalize();
+                    }
+                }
+                bench::sink = acc;
+            },
+            nSamples);
+    };
+
+    const double still = run(false);
+    const double gliding = run(true);
+    std::printf("  %2zu modes %-31s %8.3f -> %8.3f ns/sample (x%.2f)\n",
+                NLive, "tick -> tickGliding", still, gliding,
+                gliding / still);
+}
+
+// prepare rebuilds the voices, the glide set before it still applies after
+// it, the host calls prepare whenever it likes
+void survivesPrepare()
+{
+    constexpr int blockSize = 256;
+    constexpr int length = 8 * blockSize;
+
+    const auto render = [&](const float cents, const bool prepareAgain) {
+        DingSynth s;
+        s.prepare(sampleRate, blockSize);
+        s.setGlideDepth(Glide::depth(cents));
+        if (prepareAgain) {
+            s.prepare(sampleRate, blockSize);
+            s.setGlideDepth(Glide::depth(cents));
+        }
+
+        juce::AudioBuffer<float> buffer(1, length);
+        buffer.clear();
+        juce::MidiBuffer midi;
+        midi.addEvent(juce::MidiMessage::noteOn(1, 72, 1.0f), 0);
+        for (int start = 0; start < length; start += blockSize) {
+            s.renderNextBlock(buffer, start == 0 ? midi : juce::MidiBuffer{},
+                              start, blockSize);
+        }
+        return std::vector<float>(buffer.getReadPointer(0),
+                                  buffer.getReadPointer(0) + length);
+    };
+
+    const std::vector<float> still = render(0.0f, false);
+    const std::vector<float> gliding = render(Glide::s_maxCents, false);
+    const std::vector<float> prepared = render(Glide::s_maxCents, true);
+    bench::check(prepared == gliding && prepared != still,
+                 "glide kept across prepare");
+}
+
+// 8 ringing notes through the per voice engine
+void synth()
+{
+    constexpr int blockSize = 256;
+    constexpr int nBlocks = 48000 * 2 / blockSize;
+
+    const auto run = [&](const float cents) {
+        DingSynth s;
+        s.prepare(sampleRate, blockSize);
+        s.setGlideDepth(Glide::depth(cents));
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+        for (int i = 0; i < 8; ++i) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 60 + 2 * i, 1.0f), 0);
+        }
+
+        using Clock = std::chrono::steady_clock;
+        double ns = 0.0;
+        for (int b = 0; b < nBlocks; ++b) {
+            buffer.clear();
+            const auto start = Clock::now();
+            s.renderNextBlock(buffer, midi, 0, blockSize);
+            ns += std::chrono::duration<double, std::nano>(Clock::now() -
+                                                           start)
+                      .count();
+            midi.clear();
+            bench::sink = buffer.getSample(0, 0);
+        }
+        return ns / (nBlocks * blockSize);
+    };
+
+    const double still = run(0.0f);
+    const double gliding = run(Glide::s_maxCents);
+    std::printf("  %-40s %8.3f -> %8.3f ns/sample (x%.2f)\n",
+                "8 notes, per voice engine", still, gliding, gliding / still);
+}
+}  // namespace
+
+void runGlideBench()
+{
+    bench::header("glide: pitch at constant amplitude");
+    pitch();
+    survivesPrepare();
+
+    bench::header("glide: static -> gliding");
+    kernel<6>();
+    kernel<12>();
+    synth();
+}
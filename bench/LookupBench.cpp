@@ -0,0 +1,129 @@
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "core/DecibelLookup.hpp"
+#include "core/Lookups.hpp"
+
+// every lookup table against its libm equivalent: error over a dense sweep
+// of its domain and cost per call
+//
+// errors are relative for exponentials, absolute for dB
+namespace {
+constexpr std::size_t nPoints = 1 << 16;
+
+std::vector<float> sweep(const float lo, const float hi)
+{
+    std::vector<float> x(nPoints);
+    for (std::size_t i = 0; i < nPoints; ++i) {
+        x[i] = lo + (hi - lo) * static_cast<float>(i) /
+                        static_cast<float>(nPoints - 1);
+    }
+    return x;
+}
+
+template <typename F>
+double nsPerCall(const std::vector<float>& x, F&& f)
+{
+    std::vector<float> out(x.size());
+    return bench::nsPerItem(
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = f(x[i]);
+            }
+            bench::sink = out[n / 2];
+        },
+        x.size());
+}
+
+// exact is the double reference, libm the float call a table would replace
+template <typename Table, typename Exact, typename Libm>
+void measure(const char* name,
+             const float lo,
+             const float hi,
+             const bool relative,
+             Table&& table,
+             Exact&& exact,
+             Libm&& libm)
+{
+    const std::vector<float> x = sweep(lo, hi);
+
+    double maxError = 0.0;
+    double sumSquares = 0.0;
+    for (const float xi : x) {
+        const double reference = exact(static_cast<double>(xi));
+        double error = static_cast<double>(table(xi)) - reference;
+        if (relative) {
+            error /= reference;
+        }
+        maxError = std::max(maxError, std::abs(error));
+        sumSquares += error * error;
+    }
+    const double rms = std::sqrt(sumSquares / static_cast<double>(x.size()));
+
+    const double tableNs = nsPerCall(x, table);
+    const double libmNs = nsPerCall(x, libm);
+
+    std::printf("  %-18s %-4s %10.2e %10.2e %9.3f %9.3f\n", name,
+                relative ? "rel" : "abs", maxError, rms, tableNs, libmNs);
+}
+}  // namespace
+
+void runLookupBench()
+{
+    bench::header("lookup tables vs libm");
+    std::printf("  %-18s %-4s %10s %10s %9s %9s\n", "", "err", "max", "rms",
+                "ns table", "ns libm");
+
+    measure(
+        "dB -> gain", -96.0f, 12.0f, true,
+        [](float db) { return DecibelLookup::fromDb(db); },
+        [](double db) { return std::pow(10.0, db / 20.0); },
+        [](float db) { return std::pow(10.0f, db * 0.05f); });
+
+    // the usual metering range
+    measure(
+        "gain -> dB", 1e-5f, 4.0f, false,
+        [](float gain) { return Lookups::gainToDb(gain); },
+        [](double gain) { return 20.0 * std::log10(gain); },
+        [](float gain) { return 20.0f * std::log10(gain); });
+
+    measure(
+        "midi -> Hz", 0.0f, 127.0f, true,
+        [](float note) { return Lookups::MidiToHz::evaluate(note); },
+        [](double note) { return 440.0 * std::exp2((note - 69.0) / 12.0); },
+        [](float note) {
+            return 440.0f * std::exp2((note - 69.0f) * (1.0f / 12.0f));
+        });
+
+    measure(
+        "semitones -> ratio", -96.0f, 96.0f, true,
+        [](float st) { return Lookups::SemitonesToRatio::evaluate(st); },
+        [](double st) { return std::exp2(st / 12.0); },
+        [](float st) { return std::exp2(st * (1.0f / 12.0f)); });
+
+    // what matters for a decay coefficient is 1 - k, hence absolute
+    measure(
+        "exp decay", -1.0f / 32.0f, 0.0f, false,
+        [](float x) { return Lookups::ExpDecay::evaluate(x); },
+        [](double x) { return std::exp(x); },
+        [](float x) { return std::exp(x); });
+
+    measure(
+        "hf rolloff", 0.0f, 1.0f, true,
+        [](float t) { return Lookups::HfRolloff::evaluate(t); },
+        [](double t) { return std::exp(-3.0 * t); },
+        [](float t) { return std::exp(-3.0f * t); });
+
+    // the ends pan to 0, hence absolute
+    measure(
+        "pan gain", -1.0f, 1.0f, false,
+        [](float p) { return Lookups::PanGain::evaluate(p); },
+        [](double p) {
+            return std::sqrt(2.0) * std::cos((p + 1.0) * 0.25 *
+                                            juce::MathConstants<double>::pi);
+        },
+        [](float p) {
+            return 1.41421356f * std::cos((p + 1.0f) * 0.785398163f);
+        });
+}
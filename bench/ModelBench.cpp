@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/NoteTable.hpp"
+
+// the bank of instruments: every model rings and dies out within the tail,
+// a switch leaves the ringing notes alone, and what the tables cost
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 256;
+
+struct Named {
+    ModelId model;
+    const char* name;
+};
+
+constexpr Named models[] = {
+    {ModelId::lite, "glockenspiel lite"},
+    {ModelId::glockenspiel, "glockenspiel"},
+    {ModelId::hiFi, "glockenspiel hi-fi"},
+    {ModelId::celesta, "celesta"},
+    {ModelId::vibraphone, "vibraphone"},
+    {ModelId::marimba, "marimba"},
+    {ModelId::tubularBell, "tubular bell"},
+    {ModelId::crotales, "crotales"},
+};
+
+// relative decays above 1 would outlast the tail the host is told about
+void silentAfterTheTail(const ModelId model, const char* name)
+{
+    constexpr float decayMs = 500.0f;
+    const int tail =
+        static_cast<int>(Decay::tailMs(decayMs) * sampleRate / 1000.0);
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setModel(model);
+    synth.setMasterDecay(Decay::coefficient(decayMs, sampleRate));
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    midi.addEvent(juce::MidiMessage::noteOn(1, 60, 1.0f), 0);
+
+    float first = 0.0f;
+    int done = 0;
+    for (; done < tail + blockSize; done += blockSize) {
+        buffer.clear();
+        synth.renderNextBlock(buffer, done == 0 ? midi : juce::MidiBuffer{}, 0,
+                              blockSize);
+        if (done == 0) {
+            first = buffer.getMagnitude(0, blockSize);
+        }
+    }
+
+    bench::check(std::isfinite(first) && first > 0.0f && synth.isSilent(),
+                 name);
+}
+
+// a note of the glockenspiel, then a switch after the first block and a
+// second note later on
+std::vector<float> renderSwitch(const RenderEngine engine,
+                                const ModelId switchTo,
+                                const int secondNoteAt)
+{
+    constexpr int length = 12 * blockSize;
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+
+    juce::AudioBuffer<float> buffer(2, length);
+    buffer.clear();
+    for (int start = 0; start < length; start += blockSize) {
+        if (start == blockSize) {
+            synth.setModel(switchTo);
+        }
+        juce::MidiBuffer midi;
+        if (start == 0) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 60, 0.8f), 0);
+        }
+        if (start == secondNoteAt) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 79, 0.8f), start);
+        }
+        synth.renderNextBlock(buffer, midi, start, blockSize);
+    }
+
+    const float* left = buffer.getReadPointer(0);
+    return {left, left + length};
+}
+
+// the ringing note goes on as if nothing happened, the next one plays the
+// new model
+// with SSE lanes the glockenspiel takes 2 registers in the arena, the
+// vibraphone 1 and the hi-fi model 3
+void ringsOn(const RenderEngine engine, const char* name)
+{
+    constexpr int secondNoteAt = 8 * blockSize;
+    const std::vector<float> kept =
+        renderSwitch(engine, ModelId::glockenspiel, secondNoteAt);
+
+    bool ok = true;
+    for (const ModelId switchTo : {ModelId::vibraphone, ModelId::hiFi}) {
+        const std::vector<float> switched =
+            renderSwitch(engine, switchTo, secondNoteAt);
+
+        const auto split = kept.begin() + secondNoteAt;
+        const bool same = std::equal(kept.begin(), split, switched.begin());
+        const bool differs = !std::equal(split, kept.end(),
+                                         switched.begin() + secondNoteAt);
+        ok = ok && same && differs;
+    }
+    bench::check(ok, name);
+}
+
+void tables()
+{
+    NoteTable table;
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    table.prepare(sampleRate);
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+
+    std::printf("  %-40s %8.3f ms\n", "every model, every note", ms);
+    std::printf("  %-40s %8zu kB\n", "in memory",
+                s_nModels * NoteTable::s_nNotes * sizeof(ModeParameters) /
+                    1024);
+}
+
+// what the audio thread does when a program changes the model, 64 notes
+// ringing
+void switchCost()
+{
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 64; ++i) {
+        midi.addEvent(juce::MidiMessage::noteOn(1 + i % 2, 40 + i / 2, 0.8f),
+                      0);
+    }
+    buffer.clear();
+    synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+    const double ns = bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                synth.setModel(i % 2 == 0 ? ModelId::marimba
+                                          : ModelId::vibraphone);
+            }
+        },
+        1 << 16);
+    bench::report("setModel, 64 notes ringing", ns, "switch");
+}
+}  // namespace
+
+void runModelBench()
+{
+    bench::header("models: every model dies out within the tail");
+    for (const Named& named : models) {
+        silentAfterTheTail(named.model, named.name);
+    }
+
+    bench::header("models: a switch lets the ringing notes ring on");
+    ringsOn(RenderEngine::perVoice, "per voice");
+    ringsOn(RenderEngine::arena, "arena");
+    ringsOn(RenderEngine::timeAxis, "time axis");
+    ringsOn(RenderEngine::damped, "damped");
+    ringsOn(RenderEngine::resonator, "resonator");
+
+    bench::header("models: note tables, built in prepare");
+    tables();
+    switchCost();
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/DingSynth.hpp"
+
+// cost of per note pitch bend: 15 notes on the member channels of an MPE
+// lower zone, static vs every channel bending every block
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 64;
+constexpr std::size_t nVoices = 16;
+
+// lower zone, master channel 1, member channels 2..16
+constexpr int nMemberChannels = 15;
+// per note bend range of an MPE zone
+constexpr float memberBendRange = 48.0f;
+
+struct Synth {
+    DingSynth synth;
+
+    explicit Synth(const RenderEngine engine)
+    {
+        synth.prepare(sampleRate, blockSize, nVoices);
+        synth.setEngine(engine);
+    }
+
+    void render(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi)
+    {
+        buffer.clear();
+        synth.renderNextBlock(buffer, midi, 0, buffer.getNumSamples());
+    }
+};
+
+int pitchWheelFor(const float semitones)
+{
+    return juce::jlimit(0, 16383,
+                        8192 + juce::roundToInt(semitones / memberBendRange *
+                                                8192.0f));
+}
+
+// a note bent by 12 semitones at note on is the note an octave higher
+// 36 -> 48 keeps every mode below the hf knee, the levels match too
+void bendMatchesNote(const RenderEngine engine, const char* name)
+{
+    constexpr int length = 4800;
+
+    const auto renderNote = [](const RenderEngine e, const int note,
+                               const float bend) {
+        Synth s(e);
+        juce::AudioBuffer<float> buffer(1, length);
+        juce::MidiBuffer midi = juce::MPEMessages::setLowerZone(
+            nMemberChannels);
+        midi.addEvent(juce::MidiMessage::pitchWheel(2, pitchWheelFor(bend)),
+                      0);
+        midi.addEvent(juce::MidiMessage::noteOn(2, note, 0.8f), 0);
+        s.render(buffer, midi);
+        return std::vector<float>(buffer.getReadPointer(0),
+                                  buffer.getReadPointer(0) + length);
+    };
+
+    const std::vector<float> bent = renderNote(engine, 36, 12.0f);
+    const std::vector<float> straight = renderNote(engine, 48, 0.0f);
+
+    float peak = 0.0f;
+    float error = 0.0f;
+    for (int i = 0; i < length; ++i) {
+        peak = std::max(peak, std::abs(straight[i]));
+        error = std::max(error, std::abs(bent[i] - straight[i]));
+    }
+    bench::check(peak > 0.0f && error < 1e-2f * peak, name);
+}
+
+void bendCost(const RenderEngine engine, const char* name)
+{
+    constexpr int nBlocks = 48000 * 2 / blockSize;
+
+    const auto run = [&](const bool bending) {
+        Synth s(engine);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+
+        juce::MidiBuffer midi = juce::MPEMessages::setLowerZone(
+            nMemberChannels);
+        for (int i = 0; i < nMemberChannels; ++i) {
+            midi.addEvent(juce::MidiMessage::noteOn(i + 2, 60 + i, 0.8f), 0);
+        }
+        s.render(buffer, midi);
+
+        using Clock = std::chrono::steady_clock;
+        double ns = 0.0;
+        for (int b = 0; b < nBlocks; ++b) {
+            midi.clear();
+            if (bending) {
+                // slow vibrato, a different bend every block on every
+                // channel
+                for (int i = 0; i < nMemberChannels; ++i) {
+                    const float bend =
+                        0.5f * std::sin(0.05f * static_cast<float>(b + i));
+                    midi.addEvent(juce::MidiMessage::pitchWheel(
+                                      i + 2, pitchWheelFor(bend)),
+                                  0);
+                }
+            }
+
+            const auto start = Clock::now();
+            s.render(buffer, midi);
+            ns += std::chrono::duration<double, std::nano>(Clock::now() -
+                                                           start)
+                      .count();
+            bench::sink = buffer.getSample(0, 0);
+        }
+        return ns / (nBlocks * blockSize);
+    };
+
+    const double still = run(false);
+    const double bending = run(true);
+
+    std::printf("  %-40s %8.3f -> %8.3f ns/sample\n", name, still, bending);
+}
+}  // namespace
+
+void runMpeBench()
+{
+    bench::header("mpe: +12 semitones at note on is an octave up");
+    bendMatchesNote(RenderEngine::perVoice, "per voice");
+    bendMatchesNote(RenderEngine::arena, "arena");
+    bendMatchesNote(RenderEngine::timeAxis, "time axis");
+    bendMatchesNote(RenderEngine::damped, "damped");
+    bendMatchesNote(RenderEngine::resonator, "resonator");
+
+    bench::header("mpe: 15 notes, static -> bending every 64 samples");
+    bendCost(RenderEngine::perVoice, "per voice");
+    bendCost(RenderEngine::arena, "arena");
+    bendCost(RenderEngine::timeAxis, "time axis");
+    bendCost(RenderEngine::damped, "damped");
+    bendCost(RenderEngine::resonator, "resonator");
+}
@@ -0,0 +1,139 @@
+#include <array>
+
+#include "Bench.hpp"
+#include "Synth/DampedModeOscillator.hpp"
+#include "Synth/ModalBank.hpp"
+#include "Synth/SineOscillator.hpp"
+
+namespace {
+constexpr std::size_t nModes = 6;
+constexpr double sampleRate = 48000.0;
+constexpr std::size_t nSamples = 1 << 20;
+
+constexpr std::array<float, nModes> freqs = {
+    880.0f, 2425.7f, 4755.4f, 7861.0f, 11743.0f, 16562.4f,
+};
+// close to 1 so nothing goes subnormal and skews the timings
+constexpr std::array<float, nModes> decays = {
+    0.99999f, 0.99998f, 0.99997f, 0.99996f, 0.99995f, 0.99994f,
+};
+
+// the pre-ModalBank kernel: one SineOscillator and one level per mode
+void sineAndLevel()
+{
+    std::array<SineOscillator, nModes> oscs;
+    std::array<float, nModes> levels{};
+    for (std::size_t i = 0; i < nModes; ++i) {
+        oscs[i].setSampleRate(sampleRate);
+        oscs[i].setFrequency(freqs[i]);
+        levels[i] = 1.0f;
+    }
+
+    const double ns = bench::nsPerItem(
+        [&](std::size_t n) {
+            float acc = 0.0f;
+            for (std::size_t s = 0; s < n; ++s) {
+                for (std::size_t i = 0; i < nModes; ++i) {
+                    acc += oscs[i].sin() * levels[i];
+                    oscs[i].advance();
+                    levels[i] *= decays[i];
+                }
+            }
+            bench::sink = acc;
+        },
+        nSamples);
+    bench::report("SineOscillator + level", ns, "sample");
+}
+
+void damped()
+{
+    std::array<DampedModeOscillator, nModes> oscs;
+    for (std::size_t i = 0; i < nModes; ++i) {
+        oscs[i].setSampleRate(sampleRate);
+        oscs[i].setFrequency(freqs[i]);
+        oscs[i].setDecay(decays[i]);
+        oscs[i].reset(1.0f);
+    }
+
+    const double ns = bench::nsPerItem(
+        [&](std::size_t n) {
+            float acc = 0.0f;
+            for (std::size_t s = 0; s < n; ++s) {
+                for (auto& osc : oscs) {
+                    acc += osc.sin();
+                    osc.advance();
+                }
+            }
+            bench::sink = acc;
+        },
+        nSamples);
+    bench::report("DampedModeOscillator", ns, "sample");
+}
+
+void modalBank()
+{
+    ModalBank<nModes> bank;
+    for (std::size_t i = 0; i < nModes; ++i) {
+        const float inc = juce::MathConstants<float>::twoPi * freqs[i] /
+                          static_cast<float>(sampleRate);
+        bank.addMode(i, inc, 1.0f, decays[i]);
+    }
+
+    const double ns = bench::nsPerItem(
+        [&](std::size_t n) {
+            float acc = 0.0f;
+            for (std::size_t s = 0; s < n; ++s) {
+                acc += bank.tick();
+                if ((s & 255) == 255) {
+                    bank.renormalize();
+                }
+            }
+            bench::sink = acc;
+        },
+        nSamples);
+    bench::report("ModalBank::tick", ns, "sample");
+}
+
+// the tail of a 12 mode model: everything but the first nLive modes culled,
+// the kernel only pays for what is left
+double tailCost(const std::size_t nLive)
+{
+    constexpr std::size_t nModelModes = 12;
+    ModalBank<nModelModes> bank;
+    for (std::size_t i = 0; i < nModelModes; ++i) {
+        const float inc = 0.01f * static_cast<float>(i + 1);
+        bank.addMode(i, inc, i < nLive ? 1.0f : 0.0f, 0.99999f);
+    }
+    bank.cull(0.5f);
+
+    return bench::nsPerItem(
+        [&](std::size_t n) {
+            float acc = 0.0f;
+            for (std::size_t s = 0; s < n; ++s) {
+                acc += bank.tick<nModelModes>();
+                if ((s & 255) == 255) {
+                    bank.renormalize<nModelModes>();
+                }
+            }
+            bench::sink = acc;
+        },
+        nSamples);
+}
+
+void tail()
+{
+    bench::report("12 of 12 modes live", tailCost(12), "sample");
+    bench::report("2 of 12 modes live", tailCost(2), "sample");
+}
+}  // namespace
+
+void runOscillatorBench()
+{
+    bench::header("oscillator: 6 decaying modes, one output sample");
+    sineAndLevel();
+    damped();
+    modalBank();
+
+    bench::header("oscillator: culled tail of a 12 mode model");
+    tail();
+}
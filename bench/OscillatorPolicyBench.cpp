@@ -0,0 +1,111 @@
+#include <array>
+#include <cmath>
+#include <cstdio>
+
+#include "Bench.hpp"
+#include "Synth/SineOscillator.hpp"
+
+namespace {
+constexpr std::size_t nModes = 6;
+constexpr double sampleRate = 48000.0;
+constexpr std::size_t nSamples = 1 << 20;
+
+constexpr std::array<float, nModes> freqs = {
+    880.0f, 2425.7f, 4755.4f, 7861.0f, 11743.0f, 16562.4f,
+};
+
+// drift is measured after a minute of ringing, at both ends of the keyboard
+constexpr std::size_t driftSamples = 60 * 48000;
+constexpr std::size_t driftWindow = 8192;
+constexpr std::array<float, 2> driftFreqs = {27.5f, 4186.0f};
+
+struct Drift {
+    double cents;
+    double decibels;
+};
+
+// least squares fit of y = a sin(n th) + b cos(n th) over the last
+// driftWindow samples against the exact phase, in double
+// the phase of the fit is the accumulated phase error
+template <typename Policy>
+Drift measureDrift(const float freq)
+{
+    BasicSineOscillator<Policy> osc;
+    osc.setSampleRate(sampleRate);
+    osc.setFrequency(freq);
+    osc.reset();
+
+    const double th =
+        juce::MathConstants<double>::twoPi * static_cast<double>(freq) /
+        sampleRate;
+
+    double ss = 0.0, sc = 0.0, cc = 0.0, ys = 0.0, yc = 0.0;
+    for (std::size_t n = 0; n < driftSamples; ++n) {
+        if (n >= driftSamples - driftWindow) {
+            const double phase = th * static_cast<double>(n);
+            const double s = std::sin(phase);
+            const double c = std::cos(phase);
+            const double y = osc.sin();
+            ss += s * s;
+            sc += s * c;
+            cc += c * c;
+            ys += y * s;
+            yc += y * c;
+        }
+        osc.advance();
+    }
+
+    const double det = ss * cc - sc * sc;
+    const double a = (ys * cc - yc * sc) / det;
+    const double b = (yc * ss - ys * sc) / det;
+
+    const double phaseError = std::atan2(b, a);
+    const double elapsed = th * static_cast<double>(driftSamples);
+
+    return {
+        1200.0 * std::log2(1.0 + phaseError / elapsed),
+        20.0 * std::log10(std::hypot(a, b)),
+    };
+}
+
+template <typename Policy>
+void policy(const char* name)
+{
+    std::array<BasicSineOscillator<Policy>, nModes> oscs;
+    for (std::size_t i = 0; i < nModes; ++i) {
+        oscs[i].setSampleRate(sampleRate);
+        oscs[i].setFrequency(freqs[i]);
+        oscs[i].reset();
+    }
+
+    const double ns = bench::nsPerItem(
+        [&](std::size_t n) {
+            float acc = 0.0f;
+            for (std::size_t s = 0; s < n; ++s) {
+                for (auto& osc : oscs) {
+                    acc += osc.sin();
+                    osc.advance();
+                }
+            }
+            bench::sink = acc;
+        },
+        nSamples);
+    bench::report(name, ns, "sample");
+
+    for (const float freq : driftFreqs) {
+        const Drift drift = measureDrift<Policy>(freq);
+        std::printf("      %7.1f Hz: %+.2e cents, %+.2e dB\n",
+                    static_cast<double>(freq), drift.cents, drift.decibels);
+    }
+}
+}  // namespace
+
+void runOscillatorPolicyBench()
+{
+    bench::header(
+        "oscillator policies: 6 modes, one output sample, drift after 60 s");
+    policy<OscillatorPolicy::Rotation>("Rotation");
+    policy<OscillatorPolicy::FirstOrderRenorm>("FirstOrderRenorm");
+    policy<OscillatorPolicy::MagicCircle>("MagicCircle");
+    policy<OscillatorPolicy::DoublePrecision>("DoublePrecision");
+}
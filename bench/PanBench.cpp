@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/Pan.hpp"
+
+// stereo placement: the pan law, where the notes end up, and what the
+// output stage costs now that voices render mono chunks
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 256;
+constexpr int length = 8 * blockSize;
+
+struct Stereo {
+    std::vector<float> left;
+    std::vector<float> right;
+};
+
+// one note, rendered on nChannels channels
+Stereo renderNote(const RenderEngine engine,
+                  const int note,
+                  const float width,
+                  const bool decorrelate,
+                  const int nChannels)
+{
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+    synth.setStereo(width, decorrelate);
+
+    juce::AudioBuffer<float> buffer(nChannels, length);
+    buffer.clear();
+    for (int start = 0; start < length; start += blockSize) {
+        juce::MidiBuffer midi;
+        if (start == 0) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, note, 0.8f), 0);
+        }
+        synth.renderNextBlock(buffer, midi, start, blockSize);
+    }
+
+    const float* left = buffer.getReadPointer(0);
+    const float* right = buffer.getReadPointer(nChannels - 1);
+    return {{left, left + length}, {right, right + length}};
+}
+
+float energy(const std::vector<float>& samples)
+{
+    float sum = 0.0f;
+    for (const float s : samples) {
+        sum += s * s;
+    }
+    return sum;
+}
+
+float peak(const std::vector<float>& samples)
+{
+    float p = 0.0f;
+    for (const float s : samples) {
+        p = std::max(p, std::abs(s));
+    }
+    return p;
+}
+
+float maxError(const std::vector<float>& a, const std::vector<float>& b)
+{
+    float error = 0.0f;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        error = std::max(error, std::abs(a[i] - b[i]));
+    }
+    return error;
+}
+
+void constantPower()
+{
+    float error = 0.0f;
+    for (int i = -100; i <= 100; ++i) {
+        const auto gains = Pan::gains(0.01f * static_cast<float>(i));
+        error = std::max(error, std::abs(gains.left * gains.left +
+                                         gains.right * gains.right - 2.0f));
+    }
+    bench::check(error < 1e-5f, "L^2 + R^2 = 2 across the field");
+}
+
+// width 0 is the mono synth: same on both sides, and a mono output gets
+// the same samples
+void widthZeroIsMono(const RenderEngine engine, const char* name)
+{
+    const Stereo stereo = renderNote(engine, 40, 0.0f, false, 2);
+    const Stereo mono = renderNote(engine, 40, 0.0f, false, 1);
+
+    const float p = peak(stereo.left);
+    bench::check(p > 0.0f && maxError(stereo.left, stereo.right) == 0.0f &&
+                     maxError(stereo.left, mono.left) < 1e-6f * p,
+                 name);
+}
+
+// from the player's seat, low on the left, high on the right
+void lowLeftHighRight(const RenderEngine engine, const char* name)
+{
+    const Stereo low = renderNote(engine, 40, 1.0f, false, 2);
+    const Stereo high = renderNote(engine, 100, 1.0f, false, 2);
+
+    bench::check(energy(low.left) > 4.0f * energy(low.right) &&
+                     energy(high.right) > 4.0f * energy(high.left),
+                 name);
+}
+
+// a centred note stays centred as a whole, its modes don't
+void decorrelatedModes()
+{
+    constexpr int centre = (Pan::s_lowNote + Pan::s_highNote) / 2;
+    const Stereo plain = renderNote(RenderEngine::arena, centre, 1.0f, false, 2);
+    const Stereo spread = renderNote(RenderEngine::arena, centre, 1.0f, true, 2);
+
+    const float p = peak(plain.left);
+    bench::check(maxError(plain.left, plain.right) < 1e-6f * p &&
+                     maxError(spread.left, spread.right) > 1e-2f * p,
+                 "arena, centred note, modes decorrelated");
+}
+
+// the output stage of a voice on its own: per sample addSample on every
+// channel, what the voices did, against a pan gain per 64 sample chunk
+void outputStage()
+{
+    constexpr int chunkSize = 64;
+    alignas(64) std::array<float, chunkSize> chunk;
+    for (int i = 0; i < chunkSize; ++i) {
+        chunk[static_cast<std::size_t>(i)] =
+            std::sin(0.1f * static_cast<float>(i));
+    }
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    buffer.clear();
+    const auto gains = Pan::gains(0.3f);
+
+    const double perSample = bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t done = 0; done < n; done += blockSize) {
+                for (int i = 0; i < blockSize; ++i) {
+                    const float s = chunk[static_cast<std::size_t>(
+                        i % chunkSize)];
+                    for (int ch = 0; ch < 2; ++ch) {
+                        buffer.addSample(ch, i, s);
+                    }
+                }
+            }
+            bench::sink = buffer.getSample(0, 0);
+        },
+        1 << 20);
+
+    const double chunked = bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t done = 0; done < n; done += blockSize) {
+                for (int i = 0; i < blockSize; i += chunkSize) {
+                    juce::FloatVectorOperations::addWithMultiply(
+                        buffer.getWritePointer(0, i), chunk.data(),
+                        gains.left, chunkSize);
+                    juce::FloatVectorOperations::addWithMultiply(
+                        buffer.getWritePointer(1, i), chunk.data(),
+                        gains.right, chunkSize);
+                }
+            }
+            bench::sink = buffer.getSample(0, 0);
+        },
+        1 << 20);
+
+    bench::report("addSample per sample, 2 channels", perSample, "sample");
+    bench::report("panned 64 sample chunks, 2 channels", chunked, "sample");
+}
+}  // namespace
+
+void runPanBench()
+{
+    bench::header("stereo: pan law");
+    constantPower();
+
+    bench::header("stereo: width 0 sounds like the mono synth");
+    widthZeroIsMono(RenderEngine::perVoice, "per voice");
+    widthZeroIsMono(RenderEngine::arena, "arena");
+    widthZeroIsMono(RenderEngine::timeAxis, "time axis");
+    widthZeroIsMono(RenderEngine::damped, "damped");
+    widthZeroIsMono(RenderEngine::resonator, "resonator");
+
+    bench::header("stereo: low notes left, high notes right");
+    lowLeftHighRight(RenderEngine::perVoice, "per voice");
+    lowLeftHighRight(RenderEngine::arena, "arena");
+    lowLeftHighRight(RenderEngine::timeAxis, "time axis");
+    lowLeftHighRight(RenderEngine::damped, "damped");
+    lowLeftHighRight(RenderEngine::resonator, "resonator");
+    decorrelatedModes();
+
+    bench::header("stereo: output stage of a voice");
+    outputStage();
+}
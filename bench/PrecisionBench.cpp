@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/ModalBank.hpp"
+
+// float or double: both render the same notes, double keeps the phase of a
+// long low note, and what each one costs, to pick one per session
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 256;
+
+template <typename Sample>
+std::vector<double> renderNotes(const RenderEngine engine, const int length)
+{
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+
+    juce::AudioBuffer<Sample> buffer(2, length);
+    buffer.clear();
+    for (int start = 0; start < length; start += blockSize) {
+        juce::MidiBuffer midi;
+        if (start == 0) {
+            for (const int note : {36, 60, 79}) {
+                midi.addEvent(juce::MidiMessage::noteOn(1, note, 0.8f), 0);
+            }
+        }
+        synth.renderNextBlock(buffer, midi, start, blockSize);
+    }
+
+    const Sample* right = buffer.getReadPointer(1);
+    return {right, right + length};
+}
+
+// only the rounding differs
+void sameNotes(const RenderEngine engine, const char* name)
+{
+    constexpr int length = 16 * blockSize;
+    const std::vector<double> single = renderNotes<float>(engine, length);
+    const std::vector<double> twice = renderNotes<double>(engine, length);
+
+    double peak = 0.0;
+    double error = 0.0;
+    for (std::size_t i = 0; i < single.size(); ++i) {
+        peak = std::max(peak, std::abs(twice[i]));
+        error = std::max(error, std::abs(twice[i] - single[i]));
+    }
+    bench::check(peak > 0.0 && error < 1e-4 * peak, name);
+}
+
+// one undamped low mode for a minute, against the exact sine
+// the renorm once per block keeps the magnitude, only the phase drifts
+template <typename Sample>
+double phaseError()
+{
+    constexpr double frequency = 27.5;
+    constexpr int length = 60 * static_cast<int>(sampleRate);
+    const double inc = juce::MathConstants<double>::twoPi * frequency /
+                       sampleRate;
+
+    ModalBank<1, Sample> bank;
+    bank.addMode(0, static_cast<float>(inc), std::cos(inc), std::sin(inc),
+                 1.0f, 1.0f);
+
+    double error = 0.0;
+    for (int done = 0; done < length; done += blockSize) {
+        for (int i = 0; i < blockSize; ++i) {
+            const double exact = std::sin(inc * static_cast<double>(done + i));
+            const auto sample = static_cast<double>(bank.template tick<1>());
+            error = std::max(error, std::abs(sample - exact));
+        }
+        bank.template renormalize<1>();
+    }
+    return error;
+}
+
+void lowNotePhase()
+{
+    const double single = phaseError<float>();
+    const double twice = phaseError<double>();
+    std::printf("  %-40s %.2e -> %.2e\n", "27.5Hz after 60s, float -> double",
+                single, twice);
+    bench::check(twice < 1e-3 * single, "double keeps the phase");
+}
+
+template <typename Sample>
+double tickCost()
+{
+    ModalBank<s_maxModes, Sample> bank;
+    for (std::size_t i = 0; i < s_maxModes; ++i) {
+        const float inc = 0.01f * static_cast<float>(i + 1);
+        // close to 1 so nothing goes subnormal and skews the timings
+        bank.addMode(i, inc, 1.0f, 0.99999f);
+    }
+
+    return bench::nsPerItem(
+        [&](const std::size_t n) {
+            Sample acc = 0;
+            for (std::size_t s = 0; s < n; ++s) {
+                acc += bank.template tick<s_maxModes>();
+            }
+            bank.template renormalize<s_maxModes>();
+            bench::sink = static_cast<float>(acc);
+        },
+        1 << 18);
+}
+
+template <typename Sample>
+double timeAxisCost()
+{
+    constexpr std::size_t nModes = 4;
+    ModalBank<nModes, Sample> bank;
+    for (std::size_t i = 0; i < nModes; ++i) {
+        const float inc = 0.01f * static_cast<float>(i + 1);
+        bank.addMode(i, inc, 1.0f, 1.0f);
+    }
+    bank.template prepareTimeAxis<nModes>(0.99999f);
+
+    alignas(64) std::array<Sample, blockSize> out;
+    return bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t done = 0; done < n; done += blockSize) {
+                bank.template renderTimeAxis<nModes>(out.data(), blockSize);
+            }
+            bank.template renormalize<nModes>();
+            bench::sink = static_cast<float>(out[0]);
+        },
+        1 << 18);
+}
+
+// 64 ringing notes through the whole synth, volume left out
+template <typename Sample>
+double synthCost(const RenderEngine engine)
+{
+    constexpr int nBlocks = 48000 / blockSize;
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+    // nothing dies out while timing
+    synth.setMasterDecay(Decay::coefficient(10000.0f, sampleRate));
+
+    juce::AudioBuffer<Sample> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 64; ++i) {
+        midi.addEvent(juce::MidiMessage::noteOn(1 + i % 2, 40 + i / 2, 0.8f),
+                      0);
+    }
+    buffer.clear();
+    synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+    double best = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        for (int b = 0; b < nBlocks; ++b) {
+            buffer.clear();
+            synth.renderNextBlock(buffer, {}, 0, blockSize);
+            bench::sink = static_cast<float>(buffer.getSample(0, 0));
+        }
+        const double ns =
+            std::chrono::duration<double, std::nano>(Clock::now() - start)
+                .count() /
+            (nBlocks * blockSize);
+        best = run == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+void compare(const char* name, const double single, const double twice)
+{
+    std::printf("  %-34s %8.3f -> %8.3f ns/sample (x%.2f)\n", name, single,
+                twice, twice / single);
+}
+}  // namespace
+
+void runPrecisionBench()
+{
+    bench::header("precision: double renders the notes float does");
+    sameNotes(RenderEngine::perVoice, "per voice");
+    sameNotes(RenderEngine::arena, "arena");
+    sameNotes(RenderEngine::timeAxis, "time axis");
+    sameNotes(RenderEngine::damped, "damped");
+    sameNotes(RenderEngine::resonator, "resonator");
+
+    bench::header("precision: phase of a long low note");
+    lowNotePhase();
+
+    bench::header("precision: float -> double");
+    compare("ModalBank::tick, 12 modes", tickCost<float>(),
+            tickCost<double>());
+    compare("ModalBank::renderTimeAxis, 4 modes", timeAxisCost<float>(),
+            timeAxisCost<double>());
+    compare("synth, per voice, 64 notes",
+            synthCost<float>(RenderEngine::perVoice),
+            synthCost<double>(RenderEngine::perVoice));
+    compare("synth, time axis, 64 notes",
+            synthCost<float>(RenderEngine::timeAxis),
+            synthCost<double>(RenderEngine::timeAxis));
+    compare("synth, arena, 64 notes", synthCost<float>(RenderEngine::arena),
+            synthCost<double>(RenderEngine::arena));
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Bench.hpp"
+#include "PluginState.hpp"
+#include "core/SnapshotExchange.hpp"
+
+// saved state and preset switches: the state round trips, nothing damaged
+// gets through, the audio thread never adopts half a snapshot, and what
+// adopting one costs it
+namespace {
+// the size of ParameterEngine::Snapshot, every field the same number, a
+// torn copy shows
+struct Stamped {
+    std::array<std::uint32_t, 10> fields;
+
+    bool whole() const
+    {
+        return std::all_of(
+            fields.begin(), fields.end(),
+            [&](const std::uint32_t f) { return f == fields[0]; });
+    }
+};
+
+Stamped stamp(const std::uint32_t n)
+{
+    Stamped s;
+    s.fields.fill(n);
+    return s;
+}
+
+// what the processor saves today
+PluginState::State session()
+{
+    return {PluginState::s_version,
+            {{"volume", 0.5f},
+             {"engine", 1.0f},
+             {"model", 1.0f},
+             {"decay", 2500.0f},
+             {"glide", 3.5f},
+             {"width", 70.0f},
+             {"decorrelate", 1.0f},
+             {"polyphony", 2.0f},
+             {"threads", 0.0f}}};
+}
+
+void roundTrip()
+{
+    const PluginState::State saved = session();
+    juce::MemoryBlock block;
+    PluginState::write(saved, block);
+
+    const auto restored =
+        PluginState::read(block.getData(), static_cast<int>(block.getSize()));
+    bool same = restored && restored->version == saved.version &&
+                restored->values.size() == saved.values.size();
+    for (std::size_t i = 0; same && i < saved.values.size(); ++i) {
+        same = restored->values[i].id == saved.values[i].id &&
+               restored->values[i].value == saved.values[i].value;
+    }
+
+    std::printf("  %-40s %zu bytes\n", "9 parameters", block.getSize());
+    bench::check(same, "same values back");
+}
+
+// an older session doesn't have the newer parameters, a newer one has
+// parameters this one doesn't know
+void acrossVersions()
+{
+    PluginState::State older{PluginState::s_version, {{"volume", 0.25f}}};
+    older.values.push_back({"not a parameter yet", 7.0f});
+
+    juce::MemoryBlock block;
+    PluginState::write(older, block);
+    const auto restored =
+        PluginState::read(block.getData(), static_cast<int>(block.getSize()));
+
+    bench::check(restored && restored->valueOr("volume", 0.5f) == 0.25f &&
+                     restored->valueOr("decay", 1000.0f) == 1000.0f,
+                 "missing values fall back");
+}
+
+// cut anywhere, or one byte off, it's rejected rather than half applied
+void damaged()
+{
+    juce::MemoryBlock block;
+    PluginState::write(session(), block);
+    const int size = static_cast<int>(block.getSize());
+
+    bool rejected = !PluginState::read(nullptr, 0) &&
+                    !PluginState::read(block.getData(), 0);
+    for (int cut = 1; cut < size; ++cut) {
+        rejected = rejected && !PluginState::read(block.getData(), cut);
+    }
+
+    juce::MemoryBlock other = block;
+    static_cast<char*>(other.getData())[0] = 'X';
+    rejected = rejected && !PluginState::read(other.getData(), size);
+
+    bench::check(rejected, "truncated or foreign data rejected");
+}
+
+// a writer publishing as fast as it can against the audio thread adopting
+// as fast as it can, every adopted snapshot is whole and newer than the last
+void neverTorn()
+{
+    constexpr std::uint32_t nSnapshots = 200000;
+    SnapshotExchange<Stamped> exchange;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        for (std::uint32_t n = 1; n <= nSnapshots; ++n) {
+            exchange.publish(stamp(n));
+            // a single core only switches threads when one gives way
+            if (n % 16 == 0) {
+                std::this_thread::yield();
+            }
+        }
+        done = true;
+    });
+
+    bool ok = true;
+    std::uint32_t last = 0;
+    std::uint32_t nAdopted = 0;
+    Stamped adopted{};
+    for (;;) {
+        const bool finished = done.load();
+        if (exchange.adopt(adopted)) {
+            ok = ok && adopted.whole() && adopted.fields[0] > last;
+            last = adopted.fields[0];
+            ++nAdopted;
+        } else if (finished) {
+            break;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    writer.join();
+
+    std::printf("  %-40s %u of %u\n", "adopted", nAdopted, nSnapshots);
+    bench::check(ok && last == nSnapshots, "every adopted snapshot whole");
+}
+
+// two presets in a row between blocks, the second one replaces the first
+void latestOnly()
+{
+    SnapshotExchange<Stamped> exchange;
+
+    Stamped adopted{};
+    exchange.publish(stamp(30));
+    exchange.publish(stamp(20));
+    const bool latest = exchange.adopt(adopted) && adopted.fields[0] == 20;
+    const bool once = !exchange.adopt(adopted);
+
+    bench::check(latest && once, "latest snapshot adopted, once");
+}
+
+void adoptCost()
+{
+    SnapshotExchange<Stamped> exchange;
+    const Stamped preset = stamp(1);
+    Stamped adopted{};
+
+    const double idle = bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                bench::sink = static_cast<float>(exchange.adopt(adopted));
+            }
+        },
+        1 << 20);
+    const double switching = bench::nsPerItem(
+        [&](const std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                exchange.publish(preset);
+                bench::sink = static_cast<float>(exchange.adopt(adopted));
+            }
+        },
+        1 << 20);
+
+    bench::report("nothing published", idle, "block");
+    // what a PresetWrite and the next block cost, both sides
+    bench::report("publish and adopt a snapshot", switching, "switch");
+}
+}  // namespace
+
+void runPresetBench()
+{
+    bench::header("presets: saved state");
+    roundTrip();
+    acrossVersions();
+    damaged();
+
+    bench::header("presets: snapshot exchange");
+    neverTorn();
+    latestOnly();
+
+    bench::header("presets: cost on the audio thread");
+    adoptCost();
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/DingSynth.hpp"
+
+// rendering on a WorkerPool: same output as one thread, how it scales with
+// the threads, and that a few voices don't pay for the pool
+namespace {
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 64;
+
+struct Synth {
+    DingSynth synth;
+
+    Synth(const RenderEngine engine,
+          const std::size_t nVoices,
+          const std::size_t nThreads)
+    {
+        synth.prepare(sampleRate, blockSize, nVoices, nThreads);
+        synth.setEngine(engine);
+        // nothing dies out while timing
+        synth.setMasterDecay(Decay::coefficient(10000.0f, sampleRate));
+    }
+
+    // nNotes notes spread over the block, two channels so more notes than
+    // keys fit
+    void strike(juce::AudioBuffer<float>& buffer, const int nNotes)
+    {
+        juce::MidiBuffer midi;
+        for (int i = 0; i < nNotes; ++i) {
+            midi.addEvent(juce::MidiMessage::noteOn(1 + i % 2, 24 + i / 2 % 96,
+                                                    0.8f),
+                          i % blockSize);
+        }
+        render(buffer, midi);
+    }
+
+    void render(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi)
+    {
+        buffer.clear();
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+    }
+};
+
+void sameAsOneThread(const RenderEngine engine, const char* name)
+{
+    constexpr std::size_t nVoices = 96;
+    constexpr int nBlocks = 32;
+
+    const auto renderWith = [&](const std::size_t nThreads) {
+        Synth s(engine, nVoices, nThreads);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        std::vector<float> out;
+        for (int b = 0; b < nBlocks; ++b) {
+            // a new wave of notes every few blocks, steals included
+            if (b % 8 == 0) {
+                s.strike(buffer, static_cast<int>(nVoices) / 2);
+            } else {
+                s.render(buffer, {});
+            }
+            out.insert(out.end(), buffer.getReadPointer(1),
+                       buffer.getReadPointer(1) + blockSize);
+        }
+        return out;
+    };
+
+    const std::vector<float> single = renderWith(1);
+    const std::vector<float> parallel = renderWith(4);
+
+    float peak = 0.0f;
+    float error = 0.0f;
+    for (std::size_t i = 0; i < single.size(); ++i) {
+        peak = std::max(peak, std::abs(single[i]));
+        error = std::max(error, std::abs(parallel[i] - single[i]));
+    }
+    // only the order of the sums differs
+    bench::check(peak > 0.0f && error < 1e-5f * peak, name);
+}
+
+double renderCost(const RenderEngine engine,
+                  const std::size_t nVoices,
+                  const std::size_t nThreads)
+{
+    constexpr int nBlocks = 48000 / blockSize;
+
+    Synth s(engine, nVoices, nThreads);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    s.strike(buffer, static_cast<int>(nVoices));
+
+    double best = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        for (int b = 0; b < nBlocks; ++b) {
+            s.render(buffer, {});
+            bench::sink = buffer.getSample(0, 0);
+        }
+        const double ns =
+            std::chrono::duration<double, std::nano>(Clock::now() - start)
+                .count() /
+            (nBlocks * blockSize);
+        best = run == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+void scaling(const RenderEngine engine, const char* name)
+{
+    const auto nCores = std::clamp<std::size_t>(
+        static_cast<std::size_t>(juce::SystemStats::getNumCpus()), 1,
+        WorkerPool::s_maxThreads);
+
+    const double single = renderCost(engine, 256, 1);
+    for (std::size_t nThreads = 1; nThreads <= nCores; ++nThreads) {
+        const double ns =
+            nThreads == 1 ? single : renderCost(engine, 256, nThreads);
+        std::printf("  %-10s %2zu threads %23s %8.3f ns/sample (x%.2f)\n",
+                    name, nThreads, "", ns, single / ns);
+    }
+}
+
+void fewVoices(const RenderEngine engine, const char* name)
+{
+    std::printf("  %-10s %-30s %8.3f -> %8.3f ns/sample\n", name,
+                "8 voices, 1 -> 4 threads", renderCost(engine, 8, 1),
+                renderCost(engine, 8, 4));
+}
+}  // namespace
+
+void runThreadBench()
+{
+    bench::header("threads: 96 voices on 4 threads sound like on 1");
+    sameAsOneThread(RenderEngine::perVoice, "per voice");
+    sameAsOneThread(RenderEngine::arena, "arena");
+    sameAsOneThread(RenderEngine::damped, "damped");
+    sameAsOneThread(RenderEngine::resonator, "resonator");
+
+    bench::header("threads: 256 ringing voices, 64 sample blocks");
+    scaling(RenderEngine::perVoice, "per voice");
+    scaling(RenderEngine::arena, "arena");
+
+    bench::header("threads: below the parallel threshold");
+    fewVoices(RenderEngine::perVoice, "per voice");
+    fewVoices(RenderEngine::arena, "arena");
+}
@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+#include "Bench.hpp"
+#include "Synth/Decay.hpp"
+#include "Synth/DingSynth.hpp"
+#include "Synth/VoiceManager.hpp"
+
+// voice allocation: a restrike adds to the ringing note instead of
+// replacing it, steals go to the quietest voice, notes are gone by the end
+// of the tail, and neither note on nor rendering costs more with more voices
+namespace {
+constexpr double sampleRate = 48000.0;
+
+std::vector<float> render(DingSynth& synth,
+                          const juce::MidiBuffer& midi,
+                          const int length)
+{
+    juce::AudioBuffer<float> buffer(1, length);
+    buffer.clear();
+    synth.renderNextBlock(buffer, midi, 0, length);
+    return std::vector<float>(buffer.getReadPointer(0),
+                              buffer.getReadPointer(0) + length);
+}
+
+// a strike is linear: striking a ringing bar again sounds like two bars, one
+// struck later, not like a fresh note
+void restrikeIsASum(const RenderEngine engine, const char* name)
+{
+    constexpr int length = 9600;
+    constexpr int second = 3000;
+
+    const auto strikes = [&](const std::vector<int>& at) {
+        DingSynth synth;
+        synth.prepare(sampleRate, length);
+        synth.setEngine(engine);
+        juce::MidiBuffer midi;
+        for (const int position : at) {
+            midi.addEvent(juce::MidiMessage::noteOn(1, 72, 0.7f), position);
+        }
+        return render(synth, midi, length);
+    };
+
+    const std::vector<float> both = strikes({0, second});
+    const std::vector<float> first = strikes({0});
+    const std::vector<float> later = strikes({second});
+
+    float peak = 0.0f;
+    float error = 0.0f;
+    for (int i = 0; i < length; ++i) {
+        const float sum = first[i] + later[i];
+        peak = std::max(peak, std::abs(sum));
+        error = std::max(error, std::abs(both[i] - sum));
+    }
+    bench::check(peak > 0.0f && error < 1e-3f * peak, name);
+}
+
+void stealsTheQuietest()
+{
+    VoiceManager voices;
+    voices.prepare(4);
+
+    const float amplitudes[] = {0.2f, 1.0f, 0.01f, 0.6f};
+    for (int i = 0; i < 4; ++i) {
+        const auto allocation = voices.allocate(1, 60 + i);
+        voices.setAmplitude(allocation.voice, amplitudes[i]);
+    }
+
+    // note 62 is the quiet one
+    const int quiet = voices.voiceFor(1, 62);
+    const auto steal = voices.allocate(1, 70);
+    bench::check(steal.stolen && static_cast<int>(steal.voice) == quiet &&
+                     voices.voiceFor(1, 62) == VoiceManager::s_noVoice &&
+                     voices.voiceFor(1, 70) == quiet,
+                 "steal the least audible voice");
+
+    const int loud = voices.voiceFor(1, 61);
+    voices.setAmplitude(static_cast<std::size_t>(loud), 0.001f);
+    bench::check(static_cast<int>(voices.allocate(1, 71).voice) == loud,
+                 "steal follows the amplitude");
+}
+
+// the sounding list is exactly the sounding voices, through allocations,
+// steals and retirements from inside the loop
+void soundingListIsExact()
+{
+    constexpr std::size_t nVoices = 32;
+
+    VoiceManager voices;
+    voices.prepare(nVoices);
+
+    juce::Random random(42);
+    bool ok = true;
+    for (int step = 0; step < 4096 && ok; ++step) {
+        const int channel = 1 + random.nextInt(2);
+        const int note = random.nextInt(40);
+        if (voices.voiceFor(channel, note) == VoiceManager::s_noVoice) {
+            const auto allocation = voices.allocate(channel, note);
+            voices.setAmplitude(allocation.voice, random.nextFloat());
+        }
+
+        // what updateVoiceManager does when a note dies out
+        voices.forEachSounding([&](const std::size_t v) {
+            if (random.nextInt(8) == 0) {
+                voices.retire(v);
+            }
+        });
+
+        std::vector<int> seen(nVoices, 0);
+        voices.forEachSounding([&](const std::size_t v) { ++seen[v]; });
+        std::size_t nSounding = 0;
+        for (std::size_t v = 0; v < nVoices; ++v) {
+            ok = ok && seen[v] == (voices.isSounding(v) ? 1 : 0);
+            nSounding += voices.isSounding(v) ? 1 : 0;
+        }
+        ok = ok && nSounding == voices.nSounding();
+    }
+    bench::check(ok, "sounding list");
+}
+
+// the tail the plugin reports is how long a full velocity note keeps the
+// synth from being silent, and a silent synth renders nothing
+void silentAfterTheTail(const RenderEngine engine, const char* name)
+{
+    constexpr float decayMs = 500.0f;
+    constexpr int blockSize = 256;
+    const int tail =
+        static_cast<int>(Decay::tailMs(decayMs) * sampleRate / 1000.0);
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize);
+    synth.setEngine(engine);
+    synth.setMasterDecay(Decay::coefficient(decayMs, sampleRate));
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    midi.addEvent(juce::MidiMessage::noteOn(1, 72, 1.0f), 0);
+    // a held resonator note never goes back to the pool
+    midi.addEvent(juce::MidiMessage::noteOff(1, 72), 1);
+
+    bool ringsHalfway = false;
+    int done = 0;
+    for (; done < tail + blockSize; done += blockSize) {
+        buffer.clear();
+        synth.renderNextBlock(buffer, done == 0 ? midi : juce::MidiBuffer{}, 0,
+                              blockSize);
+        if (done <= tail / 2 && tail / 2 < done + blockSize) {
+            ringsHalfway = !synth.isSilent();
+        }
+    }
+
+    buffer.clear();
+    synth.renderNextBlock(buffer, {}, 0, blockSize);
+    bench::check(ringsHalfway && synth.isSilent() &&
+                     buffer.getMagnitude(0, blockSize) == 0.0f,
+                 name);
+}
+
+// 8 notes ringing, the rest of the voices idle
+double renderCost(const RenderEngine engine, const std::size_t nVoices)
+{
+    constexpr int blockSize = 64;
+    constexpr int nBlocks = 48000 / blockSize;
+
+    DingSynth synth;
+    synth.prepare(sampleRate, blockSize, nVoices);
+    synth.setEngine(engine);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+
+    juce::MidiBuffer midi;
+    for (int i = 0; i < 8; ++i) {
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60 + 3 * i, 0.8f), 0);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    for (int b = 0; b < nBlocks; ++b) {
+        buffer.clear();
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+        midi.clear();
+        bench::sink = buffer.getSample(0, 0);
+    }
+    const double ns =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return ns / (nBlocks * blockSize);
+}
+
+void renderCost(const RenderEngine engine, const char* name)
+{
+    std::printf("  %-10s", name);
+    for (const std::size_t nVoices : {16, 64, 256, 1024}) {
+        double best = renderCost(engine, nVoices);
+        for (int run = 0; run < 4; ++run) {
+            best = std::min(best, renderCost(engine, nVoices));
+        }
+        std::printf(" %8.3f", best);
+    }
+    std::printf(" ns/sample\n");
+}
+
+// walks every note of every channel, so there are always more notes than
+// voices
+int nextEvent(const int event)
+{
+    return (event + 7) % (16 * 128);
+}
+
+// every voice busy, so every note on steals, the steady state of a long
+// roll
+double voiceManagerNoteOn(const std::size_t nVoices)
+{
+    constexpr std::size_t nEvents = 1 << 16;
+
+    VoiceManager voices;
+    voices.prepare(nVoices);
+
+    int event = 0;
+    float amplitude = 1.0f;
+    return bench::nsPerItem(
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                event = nextEvent(event);
+                const int channel = 1 + event / 128;
+                const int note = event % 128;
+                if (voices.voiceFor(channel, note) != VoiceManager::s_noVoice) {
+                    continue;
+                }
+                const auto allocation = voices.allocate(channel, note);
+                // what the render would report
+                amplitude = amplitude > 0.002f ? amplitude * 0.9f : 1.0f;
+                voices.setAmplitude(allocation.voice, amplitude);
+            }
+        },
+        nEvents);
+}
+
+// same events through juce::Synthesiser with voices that do nothing
+struct NullVoice final : juce::SynthesiserVoice {
+    bool canPlaySound(juce::SynthesiserSound*) override { return true; }
+    void startNote(int, float, juce::SynthesiserSound*, int) override {}
+    void stopNote(float, bool) override {}
+    void pitchWheelMoved(int) override {}
+    void controllerMoved(int, int) override {}
+    void renderNextBlock(juce::AudioBuffer<float>&, int, int) override {}
+};
+
+struct NullSound final : juce::SynthesiserSound {
+    bool appliesToNote(int) override { return true; }
+    bool appliesToChannel(int) override { return true; }
+};
+
+double juceNoteOn(const std::size_t nVoices)
+{
+    constexpr std::size_t nEvents = 1 << 14;
+
+    juce::Synthesiser synth;
+    for (std::size_t i = 0; i < nVoices; ++i) {
+        synth.addVoice(new NullVoice());
+    }
+    synth.addSound(new NullSound());
+    synth.setCurrentPlaybackSampleRate(sampleRate);
+
+    int event = 0;
+    return bench::nsPerItem(
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                event = nextEvent(event);
+                synth.noteOn(1 + event / 128, event % 128, 0.8f);
+            }
+        },
+        nEvents);
+}
+}  // namespace
+
+void runVoiceBench()
+{
+    bench::header("voices: a restrike is the sum of two strikes");
+    restrikeIsASum(RenderEngine::perVoice, "per voice");
+    restrikeIsASum(RenderEngine::arena, "arena");
+    restrikeIsASum(RenderEngine::timeAxis, "time axis");
+    restrikeIsASum(RenderEngine::damped, "damped");
+    restrikeIsASum(RenderEngine::resonator, "resonator");
+
+    bench::header("voices: stealing");
+    stealsTheQuietest();
+    soundingListIsExact();
+
+    bench::header("voices: silent by the end of the reported tail");
+    silentAfterTheTail(RenderEngine::perVoice, "per voice");
+    silentAfterTheTail(RenderEngine::arena, "arena");
+    silentAfterTheTail(RenderEngine::timeAxis, "time axis");
+    silentAfterTheTail(RenderEngine::damped, "damped");
+    silentAfterTheTail(RenderEngine::resonator, "resonator");
+
+    bench::header("voices: 8 notes out of 16 / 64 / 256 / 1024 voices");
+    renderCost(RenderEngine::perVoice, "per voice");
+    renderCost(RenderEngine::arena, "arena");
+    renderCost(RenderEngine::resonator, "resonator");
+
+    bench::header("voices: note on with every voice busy, ns/event");
+    for (const std::size_t nVoices : {16, 64, 256}) {
+        std::printf("  %3zu voices %-29s %8.3f -> %8.3f ns/event\n", nVoices,
+                    "juce::Synthesiser -> Ding", juceNoteOn(nVoices),
+                    voiceManagerNoteOn(nVoices));
+    }
+}
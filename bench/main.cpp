@@ -0,0 +1,39 @@
+#include <cstring>
+
+#include "Bench.hpp"
+
+// usage: DingBench [filter]
+// only runs the benches whose name contains filter
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : "";
+
+    struct Entry {
+        const char* name;
+        void (*run)();
+    };
+    const Entry entries[] = {
+        {"oscillator", runOscillatorBench},
+        {"oscillator policy", runOscillatorPolicyBench},
+        {"denormal", runDenormalBench},
+        {"mpe", runMpeBench},
+        {"glide", runGlideBench},
+        {"decibel", runDecibelBench},
+        {"lookup", runLookupBench},
+        {"voices", runVoiceBench},
+        {"events", runEventBench},
+        {"threads", runThreadBench},
+        {"stereo", runPanBench},
+        {"precision", runPrecisionBench},
+        {"presets", runPresetBench},
+        {"models", runModelBench},
+    };
+
+    for (const Entry& entry : entries) {
+        if (std::strstr(entry.name, filter) != nullptr) {
+            entry.run();
+        }
+    }
+
+    return bench::failed ? 1 : 0;
+}